@@ -3,14 +3,24 @@
 set -xeu
 
 CC="g++"
-CFLAGS="-Wall -Wextra -Wpedantic -std=c++2b -O3"
+CFLAGS="-Wall -Wextra -Wpedantic -std=c++2b -O3 -pthread"
 SRC_DIR="src/pathfinder"
 SOURCES="${SRC_DIR}/main.cpp \
          ${SRC_DIR}/tester.cpp \
          ${SRC_DIR}/graphs.cpp \
-         ${SRC_DIR}/pathfinders.cpp"
+         ${SRC_DIR}/compressed_graph.cpp \
+         ${SRC_DIR}/pathfinders.cpp \
+         ${SRC_DIR}/queries.cpp \
+         ${SRC_DIR}/reordering.cpp \
+         ${SRC_DIR}/resumable.cpp"
 OUTPUT="pathfinder"
+COMPARE_SRC_DIR="src/pathfinder-compare"
+COMPARE_SOURCES="${COMPARE_SRC_DIR}/main.cpp \
+                 ${COMPARE_SRC_DIR}/results.cpp \
+                 ${COMPARE_SRC_DIR}/statistics.cpp"
+COMPARE_OUTPUT="pathfinder-compare"
 OUTPUT_DIR="./build"
 
 mkdir -p $OUTPUT_DIR
-$CC $CFLAGS -o $OUTPUT_DIR/$OUTPUT $SOURCES
\ No newline at end of file
+$CC $CFLAGS -o $OUTPUT_DIR/$OUTPUT $SOURCES
+$CC $CFLAGS -o $OUTPUT_DIR/$COMPARE_OUTPUT $COMPARE_SOURCES
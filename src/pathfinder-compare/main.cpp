@@ -0,0 +1,132 @@
+#include "../pathfinder/util.hpp"
+#include "results.hpp"
+#include "statistics.hpp"
+
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <stdexcept>
+
+void printUsage(char const* cmd, double threshold_default, double alpha_default)
+{
+    std::cout << "usage: " << cmd << " <baseline_filename> <candidate_filename> [-threshold=<slowdown_percent>] [-alpha=<significance_level>]\n"
+              << "\t<baseline_filename>, <candidate_filename> - pathfinder result files to compare,\n"
+              << "\t<slowdown_percent> - slowdown (in percent) above which a significant change is a regression [default = " << threshold_default << "],\n"
+              << "\t<significance_level> - Welch's t-test significance level [default = " << alpha_default << "]\n"
+              << "Exits with 2 if any regression is found.\n"
+              << "Both files should come from pathfinder runs with the same -seed, so that the same graphs are measured.\n"
+              << "Cells without sample statistics (no 'samples'/'stddev_nanos' columns and a single row)\n"
+              << "can't be tested for significance and are judged by <slowdown_percent> alone"
+              << '\n';
+}
+
+Results::Table readTable(char const* filename)
+{
+    std::ifstream input { filename };
+    if (!input.is_open()) {
+        throw std::runtime_error(std::string { "Failed to open " } + filename);
+    }
+
+    return Results::read(input);
+}
+
+int main(int argc, char const** argv)
+{
+    auto const threshold_default = 5.0;
+    auto const alpha_default = 0.05;
+
+    if (argc < 3) {
+        printUsage(argv[0], threshold_default, alpha_default);
+        return 1;
+    }
+
+    auto const threshold = util::parseArg(argc, argv, "-threshold=", threshold_default) / 100.0;
+    auto const alpha = util::parseArg(argc, argv, "-alpha=", alpha_default);
+
+    Results::Table baseline;
+    Results::Table candidate;
+    try {
+        baseline = readTable(argv[1]);
+        candidate = readTable(argv[2]);
+    } catch (std::exception const& e) {
+        std::cout << "[Error] " << e.what() << '\n';
+        return 1;
+    }
+
+    std::cout << std::left
+              << std::setw(10) << "graph" << std::setw(20) << "pathfinder" << std::setw(10) << "vertices"
+              << std::setw(14) << "baseline_ns" << std::setw(14) << "candidate_ns"
+              << std::setw(10) << "speedup" << std::setw(10) << "p99" << std::setw(10) << "p-value" << "verdict"
+              << '\n';
+
+    auto regression_count = 0uz;
+    auto improvement_count = 0uz;
+    auto unmatched_count = 0uz;
+
+    for (auto const& [key, old_cell] : baseline) {
+        auto const& [graph_type, pathfinder, vertex_count] = key;
+        auto const new_cell_it = candidate.find(key);
+        if (new_cell_it == candidate.end()) {
+            std::cout << "[Warning] " << graph_type << '/' << pathfinder << '/' << vertex_count << " is missing from the candidate\n";
+            ++unmatched_count;
+            continue;
+        }
+
+        auto const& new_cell = new_cell_it->second;
+        auto const old_mean = old_cell.time_nanos.mean;
+        auto const new_mean = new_cell.time_nanos.mean;
+        auto const change = old_mean > 0.0 ? new_mean / old_mean - 1.0 : 0.0;
+        auto const p_value = Statistics::welchTTest(old_cell.time_nanos, new_cell.time_nanos);
+        auto const significant = p_value < 0.0 || p_value < alpha;
+
+        char const* verdict = "~";
+        if (significant && change > threshold) {
+            verdict = "REGRESSION";
+            ++regression_count;
+        } else if (significant && change < -threshold) {
+            verdict = "improvement";
+            ++improvement_count;
+        } else if (significant && change > 0.0) {
+            verdict = "slower";
+        } else if (significant && change < 0.0) {
+            verdict = "faster";
+        }
+
+        std::stringstream speedup;
+        speedup << std::fixed << std::setprecision(3) << (new_mean > 0.0 ? old_mean / new_mean : 0.0) << 'x';
+
+        std::stringstream p99;
+        if (old_cell.p99_nanos && new_cell.p99_nanos && *old_cell.p99_nanos > 0.0) {
+            p99 << std::showpos << std::fixed << std::setprecision(1) << (*new_cell.p99_nanos / *old_cell.p99_nanos - 1.0) * 100.0 << '%';
+        } else {
+            p99 << "n/a";
+        }
+
+        std::stringstream p_value_text;
+        if (p_value < 0.0) {
+            p_value_text << "n/a";
+        } else {
+            p_value_text << std::setprecision(3) << p_value;
+        }
+
+        std::cout << std::setw(10) << graph_type << std::setw(20) << pathfinder << std::setw(10) << vertex_count
+                  << std::setw(14) << static_cast<long long>(old_mean) << std::setw(14) << static_cast<long long>(new_mean)
+                  << std::setw(10) << speedup.str() << std::setw(10) << p99.str() << std::setw(10) << p_value_text.str() << verdict
+                  << '\n';
+    }
+
+    for (auto const& [key, _] : candidate) {
+        if (!baseline.contains(key)) {
+            auto const& [graph_type, pathfinder, vertex_count] = key;
+            std::cout << "[Warning] " << graph_type << '/' << pathfinder << '/' << vertex_count << " is missing from the baseline\n";
+            ++unmatched_count;
+        }
+    }
+
+    std::cout << "Summary: " << regression_count << " regression(s), "
+              << improvement_count << " improvement(s), "
+              << unmatched_count << " unmatched cell(s)"
+              << '\n';
+
+    return regression_count > 0 ? 2 : 0;
+}
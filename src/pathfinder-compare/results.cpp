@@ -0,0 +1,122 @@
+#include "results.hpp"
+
+#include <algorithm>
+#include <sstream>
+#include <stdexcept>
+#include <unordered_map>
+#include <vector>
+
+namespace Results {
+namespace {
+std::vector<std::string> splitRow(std::string const& line)
+{
+    std::vector<std::string> fields;
+    std::stringstream stream { line };
+    std::string field;
+
+    while (std::getline(stream, field, ',')) {
+        if (!field.empty() && field.back() == '\r') {
+            field.pop_back();
+        }
+        fields.push_back(field);
+    }
+
+    return fields;
+}
+
+template <class T>
+T parseField(std::string const& field, std::string const& column, size_t line_number)
+{
+    std::stringstream stream { field };
+    T value;
+    stream >> value;
+
+    if (stream.fail()) {
+        throw std::runtime_error("Line " + std::to_string(line_number) + ": invalid value '" + field + "' in column '" + column + "'");
+    }
+
+    return value;
+}
+};
+
+Table read(std::istream& input)
+{
+    std::string line;
+    if (!std::getline(input, line)) {
+        throw std::runtime_error("Missing CSV header");
+    }
+
+    std::unordered_map<std::string, size_t> columns;
+    auto const header = splitRow(line);
+    for (auto i = 0uz; i < header.size(); ++i) {
+        columns[header[i]] = i;
+    }
+
+    auto const column = [&columns](std::string const& name) -> std::optional<size_t> {
+        auto const it = columns.find(name);
+        return it != columns.end() ? std::optional { it->second } : std::nullopt;
+    };
+
+    auto const required = [&column](std::string const& name) {
+        auto const index = column(name);
+        if (!index) {
+            throw std::runtime_error("Missing required column '" + name + "'");
+        }
+        return *index;
+    };
+
+    auto const graph_type_column = required("graph_type");
+    auto const vertex_count_column = required("vertex_count");
+    auto const pathfinder_column = required("pathfinder");
+    auto const time_column = required("time_nanos");
+    auto const edge_count_column = column("edge_count");
+    auto const samples_column = column("samples");
+    auto const stddev_column = column("stddev_nanos");
+    auto const p99_column = column("p99_nanos");
+
+    Table table;
+    auto line_number = 1uz;
+
+    while (std::getline(input, line)) {
+        ++line_number;
+        if (line.empty() || line == "\r") {
+            continue;
+        }
+
+        auto const fields = splitRow(line);
+        if (fields.size() != header.size()) {
+            throw std::runtime_error("Line " + std::to_string(line_number) + ": expected " + std::to_string(header.size()) + " fields, got " + std::to_string(fields.size()));
+        }
+
+        auto const get = [&](size_t index) { return parseField<double>(fields[index], header[index], line_number); };
+
+        auto const vertex_count = parseField<size_t>(fields[vertex_count_column], "vertex_count", line_number);
+        auto& cell = table[{ fields[graph_type_column], fields[pathfinder_column], vertex_count }];
+
+        if (edge_count_column) {
+            cell.edge_count = parseField<size_t>(fields[*edge_count_column], "edge_count", line_number);
+        }
+
+        Statistics::Summary row {
+            .count = samples_column ? parseField<size_t>(fields[*samples_column], "samples", line_number) : 1uz,
+            .mean = get(time_column),
+            .variance = 0.0,
+        };
+
+        if (stddev_column) {
+            auto const stddev = get(*stddev_column);
+            row.variance = stddev * stddev;
+        }
+
+        cell.time_nanos.merge(row);
+
+        if (p99_column) {
+            auto const p99 = get(*p99_column);
+            // The worst tail across merged rows is the conservative choice.
+            cell.p99_nanos = std::max(cell.p99_nanos.value_or(p99), p99);
+        }
+    }
+
+    return table;
+}
+};
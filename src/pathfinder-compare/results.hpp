@@ -0,0 +1,29 @@
+#pragma once
+
+#include "statistics.hpp"
+
+#include <istream>
+#include <map>
+#include <optional>
+#include <string>
+#include <tuple>
+
+namespace Results {
+// (graph type, pathfinder, vertex count).
+using CellKey = std::tuple<std::string, std::string, size_t>;
+
+struct Cell {
+    size_t edge_count = 0;
+    Statistics::Summary time_nanos {};
+    std::optional<double> p99_nanos {};
+};
+
+using Table = std::map<CellKey, Cell>;
+
+// Reads a pathfinder results CSV.
+// Required columns: graph_type, vertex_count, pathfinder, time_nanos.
+// Optional columns: edge_count, samples, stddev_nanos, p99_nanos.
+// Rows sharing a cell (e.g. concatenated runs) are merged into one sample group.
+// Throws std::runtime_error on malformed input.
+Table read(std::istream& input);
+};
@@ -0,0 +1,106 @@
+#include "statistics.hpp"
+
+#include <cmath>
+#include <limits>
+
+namespace Statistics {
+void Summary::merge(Summary const& other)
+{
+    if (other.count == 0) {
+        return;
+    }
+
+    if (count == 0) {
+        *this = other;
+        return;
+    }
+
+    auto const total = count + other.count;
+    auto const delta = other.mean - mean;
+    auto const m2 = variance * (count - 1) + other.variance * (other.count - 1)
+        + delta * delta * count * other.count / total;
+
+    mean += delta * other.count / total;
+    variance = m2 / (total - 1);
+    count = total;
+}
+
+double welchTTest(Summary const& lhs, Summary const& rhs)
+{
+    if (lhs.count < 2 || rhs.count < 2) {
+        return -1.0;
+    }
+
+    auto const lhs_se = lhs.variance / lhs.count;
+    auto const rhs_se = rhs.variance / rhs.count;
+    auto const se = lhs_se + rhs_se;
+
+    if (se == 0.0) {
+        return lhs.mean == rhs.mean ? 1.0 : 0.0;
+    }
+
+    auto const t = (lhs.mean - rhs.mean) / std::sqrt(se);
+    // Welch–Satterthwaite degrees of freedom.
+    auto const dof = se * se
+        / (lhs_se * lhs_se / (lhs.count - 1) + rhs_se * rhs_se / (rhs.count - 1));
+
+    return incompleteBeta(dof / 2, 0.5, dof / (dof + t * t));
+}
+
+double incompleteBeta(double a, double b, double x)
+{
+    if (x <= 0.0) {
+        return 0.0;
+    }
+
+    if (x >= 1.0) {
+        return 1.0;
+    }
+
+    // The continued fraction converges quickly only for x < (a + 1) / (a + b + 2).
+    if (x > (a + 1) / (a + b + 2)) {
+        return 1.0 - incompleteBeta(b, a, 1.0 - x);
+    }
+
+    auto const front = std::exp(std::lgamma(a + b) - std::lgamma(a) - std::lgamma(b)
+                           + a * std::log(x) + b * std::log(1.0 - x))
+        / a;
+
+    // Modified Lentz's method.
+    static constexpr auto kTiny = 1e-300;
+    static constexpr auto kEpsilon = 1e-12;
+    static constexpr auto kMaxIterations = 300;
+
+    auto f = 1.0;
+    auto c = 1.0;
+    auto d = 0.0;
+
+    for (auto i = 0; i <= kMaxIterations; ++i) {
+        auto const m = i / 2;
+        double numerator;
+        if (i == 0) {
+            numerator = 1.0;
+        } else if (i % 2 == 0) {
+            numerator = m * (b - m) * x / ((a + 2 * m - 1) * (a + 2 * m));
+        } else {
+            numerator = -(a + m) * (a + b + m) * x / ((a + 2 * m) * (a + 2 * m + 1));
+        }
+
+        d = 1.0 + numerator * d;
+        d = std::abs(d) < kTiny ? kTiny : d;
+        d = 1.0 / d;
+
+        c = 1.0 + numerator / c;
+        c = std::abs(c) < kTiny ? kTiny : c;
+
+        auto const cd = c * d;
+        f *= cd;
+
+        if (std::abs(1.0 - cd) < kEpsilon) {
+            return front * (f - 1.0);
+        }
+    }
+
+    return std::numeric_limits<double>::quiet_NaN();
+}
+};
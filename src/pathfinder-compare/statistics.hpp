@@ -0,0 +1,22 @@
+#pragma once
+
+#include <cstddef>
+
+namespace Statistics {
+// Mean/variance summary of a group of timing samples.
+struct Summary {
+    size_t count = 0;
+    double mean = 0.0;
+    double variance = 0.0;
+
+    // Merges another group into this one (parallel variance formula).
+    void merge(Summary const& other);
+};
+
+// Two-sided Welch's t-test p-value for the difference of means.
+// Returns a negative value if either group has less than 2 samples.
+double welchTTest(Summary const& lhs, Summary const& rhs);
+
+// Regularized incomplete beta function I_x(a, b).
+double incompleteBeta(double a, double b, double x);
+};
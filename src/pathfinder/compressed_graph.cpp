@@ -0,0 +1,117 @@
+#include "compressed_graph.hpp"
+
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+
+namespace Graphs {
+CompressedGraph::NeighborIterator::NeighborIterator(uint8_t const* bytes, Weight const* weights, size_t count)
+    : _bytes(bytes)
+    , _weights(weights)
+    , _remaining(count)
+{
+    if (_remaining != 0) {
+        _current = decode();
+    }
+}
+
+CompressedGraph::NeighborRange::NeighborRange(NeighborIterator begin, size_t size)
+    : _begin(begin)
+    , _size(size)
+{
+}
+
+CompressedGraph::NeighborIterator CompressedGraph::NeighborRange::begin() const
+{
+    return _begin;
+}
+
+std::default_sentinel_t CompressedGraph::NeighborRange::end() const
+{
+    return std::default_sentinel;
+}
+
+size_t CompressedGraph::NeighborRange::size() const
+{
+    return _size;
+}
+
+CompressedGraph::CompressedGraph(Graph const& graph)
+{
+    auto const vertex_count = graph.vertex_count();
+    if (2 * graph.edge_count() > std::numeric_limits<uint32_t>::max()) {
+        throw std::invalid_argument("Too many edges to compress");
+    }
+
+    _neighbor_offsets.reserve(vertex_count + 1);
+    _weight_offsets.reserve(vertex_count + 1);
+    _weights.reserve(2 * graph.edge_count());
+    _neighbors.reserve(2 * graph.edge_count());
+
+    std::vector<std::pair<Vertex, DistType>> adjacent;
+    for (auto u = 0uz; u < vertex_count; ++u) {
+        _neighbor_offsets.push_back(_neighbors.size());
+        _weight_offsets.push_back(_weights.size());
+
+        auto const& original = graph.adjacent(u);
+        adjacent.assign(original.begin(), original.end());
+        std::ranges::sort(adjacent);
+
+        auto previous = 0;
+        for (auto const& [v, weight] : adjacent) {
+            if (v < 0 || static_cast<size_t>(v) >= vertex_count) {
+                throw std::invalid_argument("Vertices must be numbered from 0 to V-1");
+            }
+
+            if (weight < 0 || weight > std::numeric_limits<Weight>::max()) {
+                throw std::invalid_argument("Weights must fit into one byte");
+            }
+
+            // The first neighbor is stored as is, the rest as deltas to the previous one.
+            encode(_neighbors, v - previous);
+            _weights.push_back(static_cast<Weight>(weight));
+            previous = v;
+        }
+    }
+
+    if (_neighbors.size() > std::numeric_limits<uint32_t>::max()) {
+        throw std::invalid_argument("Encoded adjacency is too large");
+    }
+
+    _neighbor_offsets.push_back(_neighbors.size());
+    _weight_offsets.push_back(_weights.size());
+}
+
+size_t CompressedGraph::vertex_count() const
+{
+    return _neighbor_offsets.size() - 1;
+}
+
+size_t CompressedGraph::edge_count() const
+{
+    return _weights.size() / 2;
+}
+
+CompressedGraph::NeighborRange CompressedGraph::adjacent(Vertex u) const
+{
+    auto const degree = _weight_offsets.at(u + 1) - _weight_offsets[u];
+    return { { _neighbors.data() + _neighbor_offsets[u], _weights.data() + _weight_offsets[u], degree }, degree };
+}
+
+size_t CompressedGraph::byte_size() const
+{
+    return _neighbor_offsets.size() * sizeof(uint32_t)
+        + _weight_offsets.size() * sizeof(uint32_t)
+        + _neighbors.size() * sizeof(uint8_t)
+        + _weights.size() * sizeof(Weight);
+}
+
+void CompressedGraph::encode(std::vector<uint8_t>& bytes, uint32_t value)
+{
+    while (value >= 0x80) {
+        bytes.push_back(static_cast<uint8_t>(value) | 0x80);
+        value >>= 7;
+    }
+    bytes.push_back(static_cast<uint8_t>(value));
+}
+};
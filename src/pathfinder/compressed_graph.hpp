@@ -0,0 +1,100 @@
+#pragma once
+
+#include "graphs.hpp"
+
+#include <cstdint>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+namespace Graphs {
+// Read-only compact graph representation: neighbor lists are sorted and stored as
+// varint-encoded deltas, weights are packed into one byte per edge.
+// Requires vertices to be numbered 0..V-1 and weights to fit into uint8_t.
+class CompressedGraph {
+public:
+    using Weight = uint8_t;
+
+    // Decodes one neighbor list on the fly, yielding (neighbor, weight) pairs.
+    class NeighborIterator {
+    public:
+        using value_type = std::pair<Vertex, DistType>;
+        using difference_type = std::ptrdiff_t;
+
+        NeighborIterator() = default;
+        NeighborIterator(uint8_t const* bytes, Weight const* weights, size_t count);
+
+        value_type operator*() const
+        {
+            return { _current, *_weights };
+        }
+
+        NeighborIterator& operator++()
+        {
+            ++_weights;
+            if (--_remaining != 0) {
+                _current += decode();
+            }
+            return *this;
+        }
+
+        void operator++(int)
+        {
+            ++*this;
+        }
+
+        bool operator==(std::default_sentinel_t) const
+        {
+            return _remaining == 0;
+        }
+
+    private:
+        // LEB128 varint.
+        Vertex decode()
+        {
+            uint32_t value = *_bytes & 0x7F;
+            for (auto shift = 7u; *_bytes++ & 0x80; shift += 7) {
+                value |= static_cast<uint32_t>(*_bytes & 0x7F) << shift;
+            }
+            return static_cast<Vertex>(value);
+        }
+
+        uint8_t const* _bytes = nullptr;
+        Weight const* _weights = nullptr;
+        size_t _remaining = 0;
+        Vertex _current = 0;
+    };
+
+    class NeighborRange {
+    public:
+        NeighborRange(NeighborIterator begin, size_t size);
+
+        NeighborIterator begin() const;
+        std::default_sentinel_t end() const;
+        size_t size() const;
+
+    private:
+        NeighborIterator _begin;
+        size_t _size;
+    };
+
+    // Throws std::invalid_argument if the graph can't be compressed.
+    CompressedGraph(Graph const& graph);
+
+    size_t vertex_count() const;
+    size_t edge_count() const;
+    NeighborRange adjacent(Vertex u) const;
+    // Memory used by the encoded adjacency, in bytes.
+    size_t byte_size() const;
+
+private:
+    static void encode(std::vector<uint8_t>& bytes, uint32_t value);
+
+    // Neighbor list of vertex u is _neighbors[_neighbor_offsets[u].._neighbor_offsets[u + 1])
+    // with weights _weights[_weight_offsets[u].._weight_offsets[u + 1]).
+    std::vector<uint32_t> _neighbor_offsets;
+    std::vector<uint32_t> _weight_offsets;
+    std::vector<uint8_t> _neighbors;
+    std::vector<Weight> _weights;
+};
+};
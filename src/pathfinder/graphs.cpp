@@ -75,6 +75,20 @@ StdRepresentation::mapped_type const& Graph::adjacent(Graphs::Vertex u) const
     return _graph.at(u);
 }
 
+size_t Graph::byte_size() const
+{
+    // Every hash map node holds a value and a next pointer, every bucket holds a pointer.
+    using AdjacentValue = StdRepresentation::mapped_type::value_type;
+    auto size = sizeof(_graph) + _graph.bucket_count() * sizeof(void*);
+
+    for (auto const& [_, adjacent] : _graph) {
+        size += sizeof(StdRepresentation::value_type) + sizeof(void*);
+        size += adjacent.bucket_count() * sizeof(void*) + adjacent.size() * (sizeof(AdjacentValue) + sizeof(void*));
+    }
+
+    return size;
+}
+
 Graph Full::generate(size_t vertex_count)
 {
     Graphs::StdRepresentation graph;
@@ -204,6 +218,29 @@ Graph Tree::generate(size_t vertex_count)
     return { graph };
 }
 
+bool Tree::matches(Graph const& graph)
+{
+    if (graph.edge_count() + 1 != graph.vertex_count()) {
+        return false;
+    }
+
+    std::unordered_set<Vertex> visited { graph.begin()->first };
+    std::vector<Vertex> stack = { graph.begin()->first };
+
+    while (!stack.empty()) {
+        auto const u = stack.back();
+        stack.pop_back();
+
+        for (auto const& [v, _] : graph.adjacent(u)) {
+            if (visited.insert(v).second) {
+                stack.push_back(v);
+            }
+        }
+    }
+
+    return visited.size() == graph.vertex_count();
+}
+
 std::vector<Graphs::Vertex> Tree::generatePruferSequence(size_t vertex_count)
 {
     auto const to_pick_count = vertex_count - 2;
@@ -39,6 +39,8 @@ public:
     EdgeConstIterator edges_end() const;
 
     StdRepresentation::mapped_type const& adjacent(Graphs::Vertex u) const;
+    // Approximate memory used by the adjacency hash maps, in bytes.
+    size_t byte_size() const;
 
 private:
     StdRepresentation _graph;
@@ -73,6 +75,8 @@ private:
 class Tree {
 public:
     static Graph generate(size_t vertex_count);
+    // Checks whether the graph is a tree (connected with exactly V - 1 edges).
+    static bool matches(Graph const& graph);
     static constexpr inline char const* name()
     {
         return "Tree";
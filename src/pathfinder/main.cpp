@@ -1,44 +1,23 @@
 #include "tester.hpp"
+#include "util.hpp"
 #include <fstream>
 #include <iostream>
 
 void printUsage(char const* cmd, size_t tr_default, size_t er_default)
 {
-    std::cout << "usage: " << cmd << " <output_filename> [-tr=<test_repeat_count>] [-er=<endpoints_generation_repeat_count>]\n"
+    std::cout << "usage: " << cmd << " <output_filename> [-tr=<test_repeat_count>] [-er=<endpoints_generation_repeat_count>] [-seed=<random_seed>] [-reorder=<reorder_output_filename>] [-compress=<compress_output_filename>] [-queries=<queries_output_filename>]\n"
               << "\t<output_filename> - filename to write results to,\n"
+              << "\t<reorder_output_filename> - if set, vertex reordering cost and speedups are also measured and written there,\n"
+              << "\t<compress_output_filename> - if set, compressed graph size and traversal throughput are also measured and written there,\n"
+              << "\t<queries_output_filename> - if set, radius and one-to-many queries are also measured against full SSSP and written there,\n"
               << "\t<test_repeat_count> - how many times each test should be repeated [default = " << tr_default << "],\n"
-              << "\t<endpoints_generation_repeat_count> - how many times start and end points should be generated [default = " << er_default << "]\n"
+              << "\t<endpoints_generation_repeat_count> - how many times start and end points should be generated [default = " << er_default << "],\n"
+              << "\t<random_seed> - seed for graph and endpoints generation, runs with the same seed test the same graphs [default = random]\n"
               << "Increasing <test_repeat_count> and <endpoints_generation_repeat_count> may lead to more precise results,\n"
               << "however they are both performance-heavy"
               << '\n';
 }
 
-template <class T>
-T parseArg(int argc, char const** argv, const std::string& arg_prefix, T const& default_value)
-{
-    for (int i = 0; i < argc; ++i) {
-        std::string arg { argv[i] };
-        if (arg.starts_with(arg_prefix)) {
-            const std::string to_parse = arg.substr(arg_prefix.size());
-            if (to_parse.empty()) {
-                return default_value;
-            }
-
-            std::stringstream stream_to_parse { to_parse };
-            T value;
-            stream_to_parse >> value;
-
-            if (stream_to_parse.fail()) {
-                return default_value;
-            }
-
-            return value;
-        }
-    }
-
-    return default_value;
-}
-
 int main(int argc, char const** argv)
 {
     auto const test_repeat_count_default = 10uz;
@@ -49,9 +28,13 @@ int main(int argc, char const** argv)
         return 1;
     }
 
-    auto const test_repeat_count = parseArg(argc, argv, "-tr=", test_repeat_count_default);
-    auto const endpoints_generation_repeat_count = parseArg(argc, argv, "-er=", endpoints_generation_repeat_count_default);
+    auto const test_repeat_count = util::parseArg(argc, argv, "-tr=", test_repeat_count_default);
+    auto const endpoints_generation_repeat_count = util::parseArg(argc, argv, "-er=", endpoints_generation_repeat_count_default);
+    auto const seed = util::parseArg(argc, argv, "-seed=", std::random_device {}());
     auto const output_filename = argv[1];
+    auto const reorder_output_filename = util::parseArg(argc, argv, "-reorder=", std::string {});
+    auto const compress_output_filename = util::parseArg(argc, argv, "-compress=", std::string {});
+    auto const queries_output_filename = util::parseArg(argc, argv, "-queries=", std::string {});
 
     std::ofstream output_stream { output_filename, std::ios_base::out | std::ios_base::trunc };
     if (!output_stream.is_open()) {
@@ -59,14 +42,59 @@ int main(int argc, char const** argv)
         return 1;
     }
 
+    std::ofstream reorder_output_stream;
+    if (!reorder_output_filename.empty()) {
+        reorder_output_stream.open(reorder_output_filename, std::ios_base::out | std::ios_base::trunc);
+        if (!reorder_output_stream.is_open()) {
+            std::cout << "[Error] Failed to open reordering output file!\n";
+            return 1;
+        }
+    }
+
+    std::ofstream compress_output_stream;
+    if (!compress_output_filename.empty()) {
+        compress_output_stream.open(compress_output_filename, std::ios_base::out | std::ios_base::trunc);
+        if (!compress_output_stream.is_open()) {
+            std::cout << "[Error] Failed to open compression output file!\n";
+            return 1;
+        }
+    }
+
+    std::ofstream queries_output_stream;
+    if (!queries_output_filename.empty()) {
+        queries_output_stream.open(queries_output_filename, std::ios_base::out | std::ios_base::trunc);
+        if (!queries_output_stream.is_open()) {
+            std::cout << "[Error] Failed to open queries output file!\n";
+            return 1;
+        }
+    }
+
     std::cout << "Starting with\n"
               << " - test_repeat_count = " << test_repeat_count << '\n'
-              << " - endpoints_generation_repeat_count = " << endpoints_generation_repeat_count
+              << " - endpoints_generation_repeat_count = " << endpoints_generation_repeat_count << '\n'
+              << " - seed = " << seed
               << '\n';
 
+    util::seedRandom(seed);
+
     Tester tester {};
     tester.runTests(output_stream, test_repeat_count, endpoints_generation_repeat_count);
-
     output_stream.close();
+
+    if (reorder_output_stream.is_open()) {
+        tester.runReorderingTests(reorder_output_stream, test_repeat_count, endpoints_generation_repeat_count);
+        reorder_output_stream.close();
+    }
+
+    if (compress_output_stream.is_open()) {
+        tester.runCompressionTests(compress_output_stream, test_repeat_count, endpoints_generation_repeat_count);
+        compress_output_stream.close();
+    }
+
+    if (queries_output_stream.is_open()) {
+        tester.runQueryTests(queries_output_stream, test_repeat_count, endpoints_generation_repeat_count);
+        queries_output_stream.close();
+    }
+
     return 0;
 }
\ No newline at end of file
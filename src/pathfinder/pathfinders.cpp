@@ -1,8 +1,20 @@
 #include "pathfinders.hpp"
 #include "graphs.hpp"
+#include "work_stealing_deque.hpp"
 
 #include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cstdint>
 #include <deque>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define PATHFINDERS_X86
+#endif
 
 namespace Pathfinders {
 Path Dijkstra::pathfind(Graph const& graph, Vertex from, Vertex to)
@@ -112,7 +124,96 @@ Path BellmanFord::pathfind(const Graph& graph, Vertex from, Vertex to)
     return path;
 }
 
-Path SPFA::pathfind(const Graph& graph, Vertex from, Vertex to)
+namespace {
+struct WeightedEdge {
+    Vertex u;
+    Vertex v;
+    DistType weight;
+};
+
+static constexpr auto kBatchWidth = MultiSourceBellmanFord::kBatchWidth;
+// Unreachable lanes hold half of kDistInf, so adding a weight can't overflow.
+static constexpr DistType kLaneInf = kDistInf / 2;
+
+// One Bellman-Ford pass over all edges for all lanes. Returns whether any lane changed.
+bool relaxScalar(std::vector<WeightedEdge> const& edges, DistType* dist, Vertex* prev)
+{
+    auto changed = false;
+
+    for (auto const [u, v, weight] : edges) {
+        auto const* dist_u = dist + u * kBatchWidth;
+        auto* dist_v = dist + v * kBatchWidth;
+        auto* prev_v = prev + v * kBatchWidth;
+
+        for (auto lane = 0uz; lane < kBatchWidth; ++lane) {
+            auto const alt = dist_u[lane] + weight;
+            if (dist_v[lane] > alt) {
+                dist_v[lane] = alt;
+                prev_v[lane] = u;
+                changed = true;
+            }
+        }
+    }
+
+    return changed;
+}
+
+#ifdef PATHFINDERS_X86
+__attribute__((target("avx2"))) bool relaxAvx2(std::vector<WeightedEdge> const& edges, DistType* dist, Vertex* prev)
+{
+    static_assert(kBatchWidth % 8 == 0);
+    auto changed = _mm256_setzero_si256();
+
+    for (auto const [u, v, weight] : edges) {
+        auto const weights = _mm256_set1_epi32(weight);
+        auto const us = _mm256_set1_epi32(u);
+
+        for (auto lane = 0uz; lane < kBatchWidth; lane += 8) {
+            auto* dist_u = reinterpret_cast<__m256i const*>(dist + u * kBatchWidth + lane);
+            auto* dist_v = reinterpret_cast<__m256i*>(dist + v * kBatchWidth + lane);
+            auto* prev_v = reinterpret_cast<__m256i*>(prev + v * kBatchWidth + lane);
+
+            auto const alt = _mm256_add_epi32(_mm256_loadu_si256(dist_u), weights);
+            auto const old = _mm256_loadu_si256(dist_v);
+            auto const improved = _mm256_cmpgt_epi32(old, alt);
+
+            _mm256_storeu_si256(dist_v, _mm256_min_epi32(old, alt));
+            _mm256_storeu_si256(prev_v, _mm256_blendv_epi8(_mm256_loadu_si256(prev_v), us, improved));
+            changed = _mm256_or_si256(changed, improved);
+        }
+    }
+
+    return !_mm256_testz_si256(changed, changed);
+}
+
+__attribute__((target("avx512f"))) bool relaxAvx512(std::vector<WeightedEdge> const& edges, DistType* dist, Vertex* prev)
+{
+    static_assert(kBatchWidth % 16 == 0);
+    __mmask16 changed = 0;
+
+    for (auto const [u, v, weight] : edges) {
+        auto const weights = _mm512_set1_epi32(weight);
+        auto const us = _mm512_set1_epi32(u);
+
+        for (auto lane = 0uz; lane < kBatchWidth; lane += 16) {
+            auto* dist_v = dist + v * kBatchWidth + lane;
+            auto* prev_v = prev + v * kBatchWidth + lane;
+
+            auto const alt = _mm512_add_epi32(_mm512_loadu_si512(dist + u * kBatchWidth + lane), weights);
+            auto const improved = _mm512_cmpgt_epi32_mask(_mm512_loadu_si512(dist_v), alt);
+
+            _mm512_mask_storeu_epi32(dist_v, improved, alt);
+            _mm512_mask_storeu_epi32(prev_v, improved, us);
+            changed |= improved;
+        }
+    }
+
+    return changed != 0;
+}
+#endif
+
+template <class G>
+Path spfa(G const& graph, Vertex from, Vertex to)
 {
     std::vector<DistType> dist(graph.vertex_count(), kDistInf);
     Path prev(graph.vertex_count(), kVertexError);
@@ -149,4 +250,351 @@ Path SPFA::pathfind(const Graph& graph, Vertex from, Vertex to)
     std::ranges::reverse(path);
     return path;
 }
+
+template <class G>
+Path parallelSpfa(G const& graph, Vertex from, Vertex to, size_t thread_count)
+{
+    // A label packs (dist, prev) into one word so both are updated by a single CAS.
+    // Comparing labels orders them by dist first, so the CAS-min keeps the shortest
+    // distance and, among equal ones, the smallest predecessor - the result does not
+    // depend on thread scheduling.
+    using Label = uint64_t;
+    auto const pack = [](DistType dist, Vertex prev) { return (Label { static_cast<uint32_t>(dist) } << 32) | static_cast<uint32_t>(prev); };
+    auto const unpackDist = [](Label label) { return static_cast<DistType>(label >> 32); };
+    auto const unpackPrev = [](Label label) { return static_cast<Vertex>(static_cast<uint32_t>(label)); };
+
+    auto const vertex_count = graph.vertex_count();
+    thread_count = std::clamp(thread_count, 1uz, vertex_count);
+
+    std::vector<std::atomic<Label>> labels(vertex_count);
+    std::vector<std::atomic<bool>> in_queue(vertex_count);
+    for (auto v = 0uz; v < vertex_count; ++v) {
+        labels[v].store(pack(kDistInf, kVertexError), std::memory_order_relaxed);
+        in_queue[v].store(false, std::memory_order_relaxed);
+    }
+
+    // Every vertex is queued at most once at a time, so a deque never holds more than V items.
+    std::vector<std::unique_ptr<util::WorkStealingDeque<Vertex>>> queues;
+    for (auto i = 0uz; i < thread_count; ++i) {
+        queues.push_back(std::make_unique<util::WorkStealingDeque<Vertex>>(vertex_count));
+    }
+
+    // Number of queued or in-process vertices. It is incremented before a vertex is
+    // pushed and decremented only after its relaxations are done, so it reaches zero
+    // exactly when no work is left anywhere.
+    std::atomic<size_t> pending = 1;
+    labels[from].store(pack(0, kVertexError), std::memory_order_relaxed);
+    in_queue[from].store(true, std::memory_order_relaxed);
+    queues[0]->push(from);
+
+    auto const worker = [&](size_t self) {
+        auto& own = *queues[self];
+
+        auto const next = [&]() -> std::optional<Vertex> {
+            if (auto const u = own.pop()) {
+                return u;
+            }
+
+            for (auto i = 1uz; i < thread_count; ++i) {
+                if (auto const u = queues[(self + i) % thread_count]->steal()) {
+                    return u;
+                }
+            }
+
+            return std::nullopt;
+        };
+
+        while (pending.load(std::memory_order_acquire) != 0) {
+            auto const u = next();
+            if (!u) {
+                std::this_thread::yield();
+                continue;
+            }
+
+            // Cleared before reading the label so that a concurrent improvement re-queues u.
+            // This store/load pair and the improver's CAS/exchange pair below form a
+            // store-buffering pattern, so all four must be seq_cst: then either this load
+            // sees the improved label or the improver's exchange sees `false` and re-queues u.
+            in_queue[*u].store(false, std::memory_order_seq_cst);
+            auto const dist_u = unpackDist(labels[*u].load(std::memory_order_seq_cst));
+
+            for (auto const& [v, weight] : graph.adjacent(*u)) {
+                auto const candidate = pack(dist_u + weight, *u);
+                auto current = labels[v].load(std::memory_order_relaxed);
+                auto improved = false;
+
+                while (candidate < current) {
+                    if (labels[v].compare_exchange_weak(current, candidate, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+                        improved = true;
+                        break;
+                    }
+                }
+
+                if (improved && !in_queue[v].exchange(true, std::memory_order_seq_cst)) {
+                    pending.fetch_add(1, std::memory_order_relaxed);
+                    own.push(v);
+                }
+            }
+
+            pending.fetch_sub(1, std::memory_order_acq_rel);
+        }
+    };
+
+    std::vector<std::jthread> workers;
+    for (auto i = 1uz; i < thread_count; ++i) {
+        workers.emplace_back(worker, i);
+    }
+    worker(0);
+    workers.clear();
+
+    Path path = { to };
+    while (from != to) {
+        to = unpackPrev(labels[to].load(std::memory_order_relaxed));
+        path.push_back(to);
+    }
+
+    std::ranges::reverse(path);
+    return path;
+}
+
+};
+
+MultiSourceBellmanFord::SimdLevel MultiSourceBellmanFord::simdLevel()
+{
+#ifdef PATHFINDERS_X86
+    if (__builtin_cpu_supports("avx512f")) {
+        return SimdLevel::Avx512;
+    }
+
+    if (__builtin_cpu_supports("avx2")) {
+        return SimdLevel::Avx2;
+    }
+#endif
+
+    return SimdLevel::Scalar;
+}
+
+std::vector<Path> MultiSourceBellmanFord::pathfind(Graph const& graph, std::vector<Vertex> const& sources, Vertex to)
+{
+    return pathfind(graph, sources, to, simdLevel());
+}
+
+std::vector<Path> MultiSourceBellmanFord::pathfind(Graph const& graph, std::vector<Vertex> const& sources, Vertex to, SimdLevel level)
+{
+    level = std::min(level, simdLevel());
+    auto const relax = [level] {
+#ifdef PATHFINDERS_X86
+        switch (level) {
+        case SimdLevel::Avx512:
+            return relaxAvx512;
+        case SimdLevel::Avx2:
+            return relaxAvx2;
+        case SimdLevel::Scalar:
+            break;
+        }
+#endif
+        return relaxScalar;
+    }();
+
+    // The same edge order as BellmanFord, so every lane reproduces its result exactly.
+    std::vector<WeightedEdge> edges;
+    edges.reserve(2 * graph.edge_count());
+    for (auto edge_it = graph.edges_begin(); edge_it != graph.edges_end(); ++edge_it) {
+        auto const [u, v] = *edge_it;
+        edges.push_back({ u, v, graph.adjacent(u).at(v) });
+    }
+
+    std::vector<Path> paths;
+    paths.reserve(sources.size());
+    std::vector<DistType> dist(graph.vertex_count() * kBatchWidth);
+    Path prev(graph.vertex_count() * kBatchWidth);
+
+    for (auto batch_begin = 0uz; batch_begin < sources.size(); batch_begin += kBatchWidth) {
+        auto const batch_size = std::min(kBatchWidth, sources.size() - batch_begin);
+
+        // Unused lanes stay unreachable and never change.
+        std::ranges::fill(dist, kLaneInf);
+        std::ranges::fill(prev, kVertexError);
+        for (auto lane = 0uz; lane < batch_size; ++lane) {
+            dist[sources[batch_begin + lane] * kBatchWidth + lane] = 0;
+        }
+
+        for (auto i = 1uz; i < graph.vertex_count(); ++i) {
+            if (!relax(edges, dist.data(), prev.data())) {
+                break;
+            }
+        }
+
+        for (auto lane = 0uz; lane < batch_size; ++lane) {
+            auto const from = sources[batch_begin + lane];
+            auto current = to;
+
+            Path path = { current };
+            while (from != current) {
+                current = prev[current * kBatchWidth + lane];
+                path.push_back(current);
+            }
+
+            std::ranges::reverse(path);
+            paths.push_back(std::move(path));
+        }
+    }
+
+    return paths;
+}
+
+Path SPFA::pathfind(Graph const& graph, Vertex from, Vertex to)
+{
+    return spfa(graph, from, to);
+}
+
+Path SPFA::pathfind(CompressedGraph const& graph, Vertex from, Vertex to)
+{
+    return spfa(graph, from, to);
+}
+
+Path ParallelSPFA::pathfind(Graph const& graph, Vertex from, Vertex to)
+{
+    return pathfind(graph, from, to, std::max(1u, std::thread::hardware_concurrency()));
+}
+
+Path ParallelSPFA::pathfind(Graph const& graph, Vertex from, Vertex to, size_t thread_count)
+{
+    return parallelSpfa(graph, from, to, thread_count);
+}
+
+Path ParallelSPFA::pathfind(CompressedGraph const& graph, Vertex from, Vertex to)
+{
+    return pathfind(graph, from, to, std::max(1u, std::thread::hardware_concurrency()));
+}
+
+Path ParallelSPFA::pathfind(CompressedGraph const& graph, Vertex from, Vertex to, size_t thread_count)
+{
+    return parallelSpfa(graph, from, to, thread_count);
+}
+
+TreeIndex::TreeIndex(Graph const& graph)
+    : _parent(graph.vertex_count(), kVertexError)
+    , _depth(graph.vertex_count())
+    , _root_dist(graph.vertex_count())
+    , _first(graph.vertex_count())
+{
+    if (!Tree::matches(graph)) {
+        throw std::invalid_argument("TreeIndex requires a tree");
+    }
+
+    std::vector<Vertex> euler;
+    euler.reserve(2 * graph.vertex_count() - 1);
+
+    // Iterative DFS: each stack entry is a vertex and the adjacency position to resume from.
+    using AdjacentIterator = StdRepresentation::mapped_type::const_iterator;
+    auto const root = graph.begin()->first;
+    std::vector<std::pair<Vertex, AdjacentIterator>> stack = { { root, graph.adjacent(root).begin() } };
+    _first[root] = 0;
+    euler.push_back(root);
+
+    while (!stack.empty()) {
+        auto& [u, it] = stack.back();
+        auto const& adjacent = graph.adjacent(u);
+
+        while (it != adjacent.end() && it->first == _parent[u]) {
+            ++it;
+        }
+
+        if (it == adjacent.end()) {
+            stack.pop_back();
+            if (!stack.empty()) {
+                euler.push_back(stack.back().first);
+            }
+            continue;
+        }
+
+        auto const [v, weight] = *it++;
+        _parent[v] = u;
+        _depth[v] = _depth[u] + 1;
+        _root_dist[v] = _root_dist[u] + weight;
+        _first[v] = euler.size();
+        euler.push_back(v);
+        stack.emplace_back(v, graph.adjacent(v).begin());
+    }
+
+    auto const shallower = [this](Vertex u, Vertex v) { return _depth[u] <= _depth[v] ? u : v; };
+
+    _sparse.push_back(std::move(euler));
+    for (auto k = 1uz; (1uz << k) <= _sparse[0].size(); ++k) {
+        auto const& previous = _sparse[k - 1];
+        auto const half = 1uz << (k - 1);
+        std::vector<Vertex> level(_sparse[0].size() - (1uz << k) + 1);
+
+        for (auto i = 0uz; i < level.size(); ++i) {
+            level[i] = shallower(previous[i], previous[i + half]);
+        }
+
+        _sparse.push_back(std::move(level));
+    }
+}
+
+Vertex TreeIndex::lca(Vertex u, Vertex v) const
+{
+    auto left = _first.at(u);
+    auto right = _first.at(v);
+    if (left > right) {
+        std::swap(left, right);
+    }
+
+    auto const k = std::bit_width(right - left + 1) - 1;
+    auto const lhs = _sparse[k][left];
+    auto const rhs = _sparse[k][right + 1 - (1uz << k)];
+    return _depth[lhs] <= _depth[rhs] ? lhs : rhs;
+}
+
+DistType TreeIndex::distance(Vertex u, Vertex v) const
+{
+    return _root_dist.at(u) + _root_dist.at(v) - 2 * _root_dist[lca(u, v)];
+}
+
+Path TreeIndex::path(Vertex from, Vertex to) const
+{
+    auto const ancestor = lca(from, to);
+
+    Path path;
+    path.reserve(_depth[from] + _depth[to] - 2 * _depth[ancestor] + 1);
+    for (auto v = from; v != ancestor; v = _parent[v]) {
+        path.push_back(v);
+    }
+    path.push_back(ancestor);
+
+    auto const middle = path.size();
+    for (auto v = to; v != ancestor; v = _parent[v]) {
+        path.push_back(v);
+    }
+
+    std::ranges::reverse(path.begin() + middle, path.end());
+    return path;
+}
+
+Path TreeLCA::pathfind(Graph const& graph, Vertex from, Vertex to)
+{
+    return pathfind(prepare(graph), from, to);
+}
+
+TreeIndex TreeLCA::prepare(Graph const& graph)
+{
+    return TreeIndex { graph };
+}
+
+Path TreeLCA::pathfind(TreeIndex const& index, Vertex from, Vertex to)
+{
+    return index.path(from, to);
+}
+
+DistType TreeLCA::distance(TreeIndex const& index, Vertex from, Vertex to)
+{
+    return index.distance(from, to);
+}
+
+bool TreeLCA::accepts(Graph const& graph)
+{
+    return Tree::matches(graph);
+}
 }
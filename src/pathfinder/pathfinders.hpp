@@ -1,5 +1,6 @@
 #pragma once
 
+#include "compressed_graph.hpp"
 #include "graphs.hpp"
 #include <vector>
 
@@ -36,12 +37,93 @@ public:
     }
 };
 
+// Bellman-Ford for many sources at once. Distances of kBatchWidth sources are stored
+// interleaved per vertex, so a single pass over the edge list relaxes every edge for
+// all of them with AVX-512/AVX2 min-plus lanes (chosen at runtime, with a scalar
+// fallback). Passes stop as soon as no lane changes.
+class MultiSourceBellmanFord {
+public:
+    static constexpr size_t kBatchWidth = 16;
+
+    enum class SimdLevel {
+        Scalar,
+        Avx2,
+        Avx512
+    };
+
+    // The best level supported by the running CPU.
+    static SimdLevel simdLevel();
+
+    // Returns the path from every source to `to`, in the order of `sources`.
+    static std::vector<Path> pathfind(Graph const& graph, std::vector<Vertex> const& sources, Vertex to);
+    // Uses at most the given SIMD level.
+    static std::vector<Path> pathfind(Graph const& graph, std::vector<Vertex> const& sources, Vertex to, SimdLevel level);
+    static constexpr inline char const* name()
+    {
+        return "Multi-Source-Bellman-Ford";
+    }
+};
+
 class SPFA {
 public:
     static Path pathfind(Graph const& graph, Vertex from, Vertex to);
+    static Path pathfind(CompressedGraph const& graph, Vertex from, Vertex to);
     static constexpr inline char const* name()
     {
         return "SPFA";
     }
 };
+
+// Label-correcting SPFA run by several threads: every worker owns a work-stealing
+// deque, labels are relaxed with an atomic CAS-min and an in-queue flag per vertex
+// suppresses duplicate work.
+class ParallelSPFA {
+public:
+    static Path pathfind(Graph const& graph, Vertex from, Vertex to);
+    static Path pathfind(Graph const& graph, Vertex from, Vertex to, size_t thread_count);
+    static Path pathfind(CompressedGraph const& graph, Vertex from, Vertex to);
+    static Path pathfind(CompressedGraph const& graph, Vertex from, Vertex to, size_t thread_count);
+    static constexpr inline char const* name()
+    {
+        return "Parallel-SPFA";
+    }
+};
+
+// Lowest common ancestor index over a tree: Euler tour + sparse table.
+// Distance queries are O(1), path queries are O(path length).
+class TreeIndex {
+public:
+    // Throws std::invalid_argument if the graph is not a tree.
+    TreeIndex(Graph const& graph);
+
+    Vertex lca(Vertex u, Vertex v) const;
+    DistType distance(Vertex u, Vertex v) const;
+    Path path(Vertex from, Vertex to) const;
+
+private:
+    std::vector<Vertex> _parent;
+    std::vector<size_t> _depth;
+    std::vector<DistType> _root_dist;
+    // Index of the first occurrence of each vertex in the Euler tour.
+    std::vector<size_t> _first;
+    // _sparse[k][i] - the shallowest vertex among Euler tour entries [i, i + 2^k).
+    std::vector<std::vector<Vertex>> _sparse;
+};
+
+// Tree-only pathfinder: the path between two vertices of a tree is unique,
+// so it is recovered straight from the LCA index.
+class TreeLCA {
+public:
+    // Builds the index on every call; repeated queries on one graph should
+    // build it once with `prepare` and query it with the overloads below.
+    static Path pathfind(Graph const& graph, Vertex from, Vertex to);
+    static TreeIndex prepare(Graph const& graph);
+    static Path pathfind(TreeIndex const& index, Vertex from, Vertex to);
+    static DistType distance(TreeIndex const& index, Vertex from, Vertex to);
+    static bool accepts(Graph const& graph);
+    static constexpr inline char const* name()
+    {
+        return "Tree-LCA";
+    }
+};
 };
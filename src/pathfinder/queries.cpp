@@ -0,0 +1,102 @@
+#include "queries.hpp"
+
+#include <functional>
+#include <queue>
+
+namespace Queries {
+namespace {
+// Dijkstra with a binary heap. `settle(v, dist)` is called for every vertex in order of
+// increasing distance; the search stops when it returns false.
+template <class F>
+void search(Graph const& graph, Vertex source, F&& settle)
+{
+    std::vector<DistType> dist(graph.vertex_count(), kDistInf);
+    std::priority_queue<std::pair<DistType, Vertex>, std::vector<std::pair<DistType, Vertex>>, std::greater<>> heap;
+
+    dist.at(source) = 0;
+    heap.emplace(0, source);
+
+    while (!heap.empty()) {
+        auto const [u_dist, u] = heap.top();
+        heap.pop();
+
+        // A stale entry: u has already been settled with a smaller distance.
+        if (u_dist != dist[u]) {
+            continue;
+        }
+
+        if (!settle(u, u_dist)) {
+            return;
+        }
+
+        for (auto const& [v, weight] : graph.adjacent(u)) {
+            auto const alt = u_dist + weight;
+            if (alt < dist[v]) {
+                dist[v] = alt;
+                heap.emplace(alt, v);
+            }
+        }
+    }
+}
+};
+
+std::vector<DistType> AllDistances::query(Graph const& graph, Vertex source)
+{
+    std::vector<DistType> dist(graph.vertex_count(), kDistInf);
+    search(graph, source, [&dist](Vertex v, DistType v_dist) {
+        dist[v] = v_dist;
+        return true;
+    });
+
+    return dist;
+}
+
+Reached Radius::query(Graph const& graph, Vertex source, DistType radius)
+{
+    Reached reached;
+    search(graph, source, [&reached, radius](Vertex v, DistType v_dist) {
+        if (v_dist > radius) {
+            return false;
+        }
+
+        reached.vertices.push_back(v);
+        reached.dists.push_back(v_dist);
+        return true;
+    });
+
+    return reached;
+}
+
+TargetDistances OneToMany::query(Graph const& graph, Vertex source, std::vector<Vertex> const& targets)
+{
+    // Position of every distinct target in `targets`, so settling a vertex is O(1) to check.
+    std::vector<std::vector<size_t>> positions(graph.vertex_count());
+    auto remaining = 0uz;
+    for (auto i = 0uz; i < targets.size(); ++i) {
+        auto& target_positions = positions.at(targets[i]);
+        if (target_positions.empty()) {
+            ++remaining;
+        }
+        target_positions.push_back(i);
+    }
+
+    TargetDistances result { std::vector<DistType>(targets.size(), kDistInf), 0 };
+    if (remaining == 0) {
+        return result;
+    }
+
+    search(graph, source, [&](Vertex v, DistType v_dist) {
+        ++result.settled;
+        if (positions[v].empty()) {
+            return true;
+        }
+
+        for (auto const i : positions[v]) {
+            result.dists[i] = v_dist;
+        }
+        return --remaining != 0;
+    });
+
+    return result;
+}
+};
@@ -0,0 +1,55 @@
+#pragma once
+
+#include "graphs.hpp"
+
+#include <vector>
+
+// Distance queries that only explore as much of the graph as they need.
+namespace Queries {
+using namespace Graphs;
+
+// Reached vertices and their distances, in order of increasing distance.
+struct Reached {
+    std::vector<Vertex> vertices;
+    std::vector<DistType> dists;
+};
+
+// Full single-source distances (kDistInf for unreachable vertices), indexed by vertex.
+class AllDistances {
+public:
+    static std::vector<DistType> query(Graph const& graph, Vertex source);
+    static constexpr inline char const* name()
+    {
+        return "All-Distances";
+    }
+};
+
+// All vertices within `radius` of `source` (an isochrone).
+// The search stops at the first vertex farther than `radius`.
+class Radius {
+public:
+    static Reached query(Graph const& graph, Vertex source, DistType radius);
+    static constexpr inline char const* name()
+    {
+        return "Radius";
+    }
+};
+
+// Distances to the targets of a one-to-many query, plus how many vertices
+// the search settled before it could stop.
+struct TargetDistances {
+    std::vector<DistType> dists;
+    size_t settled;
+};
+
+// Distances from `source` to each of `targets`, in the same order (kDistInf if unreachable).
+// The search stops as soon as every target is settled.
+class OneToMany {
+public:
+    static TargetDistances query(Graph const& graph, Vertex source, std::vector<Vertex> const& targets);
+    static constexpr inline char const* name()
+    {
+        return "One-To-Many";
+    }
+};
+};
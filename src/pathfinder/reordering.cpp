@@ -0,0 +1,211 @@
+#include "reordering.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <deque>
+#include <numeric>
+#include <queue>
+#include <stdexcept>
+
+namespace Reordering {
+Permutation::Permutation(std::vector<Vertex> order)
+    : _to_original(std::move(order))
+    , _to_reordered(_to_original.size(), kVertexError)
+{
+    for (auto i = 0uz; i < _to_original.size(); ++i) {
+        auto const original = _to_original[i];
+        if (original < 0 || static_cast<size_t>(original) >= _to_original.size() || _to_reordered[original] != kVertexError) {
+            throw std::invalid_argument("The order must be a permutation of vertices");
+        }
+
+        _to_reordered[original] = i;
+    }
+}
+
+Vertex Permutation::toReordered(Vertex original) const
+{
+    return _to_reordered.at(original);
+}
+
+Vertex Permutation::toOriginal(Vertex reordered) const
+{
+    return _to_original.at(reordered);
+}
+
+Path Permutation::toOriginal(Path path) const
+{
+    for (auto& v : path) {
+        v = toOriginal(v);
+    }
+
+    return path;
+}
+
+Graph Permutation::apply(Graph const& graph) const
+{
+    StdRepresentation reordered;
+    reordered.reserve(graph.vertex_count());
+
+    // Inserting in the new id order keeps the adjacency lists allocated in that order too.
+    for (auto u = 0uz; u < _to_original.size(); ++u) {
+        auto& adjacent = reordered[u];
+        auto const& original_adjacent = graph.adjacent(_to_original[u]);
+        adjacent.reserve(original_adjacent.size());
+
+        for (auto const& [v, weight] : original_adjacent) {
+            adjacent[_to_reordered[v]] = weight;
+        }
+    }
+
+    return { reordered };
+}
+
+ReorderedGraph::ReorderedGraph(Graph const& graph, Permutation permutation)
+    : _permutation(std::move(permutation))
+    , _graph(_permutation.apply(graph))
+{
+}
+
+Graph const& ReorderedGraph::graph() const
+{
+    return _graph;
+}
+
+Permutation const& ReorderedGraph::permutation() const
+{
+    return _permutation;
+}
+
+Permutation CuthillMcKee::order(Graph const& graph)
+{
+    auto const vertex_count = graph.vertex_count();
+    auto const degree = [&graph](Vertex v) { return graph.adjacent(v).size(); };
+
+    std::vector<Vertex> by_degree(vertex_count);
+    std::iota(by_degree.begin(), by_degree.end(), 0);
+    std::ranges::stable_sort(by_degree, {}, degree);
+
+    std::vector<Vertex> order;
+    order.reserve(vertex_count);
+    std::vector<bool> visited(vertex_count);
+    std::vector<Vertex> neighbors;
+
+    // Every unvisited minimum degree vertex starts the BFS of its component.
+    for (auto const start : by_degree) {
+        if (visited[start]) {
+            continue;
+        }
+
+        visited[start] = true;
+        std::deque<Vertex> queue = { start };
+
+        while (!queue.empty()) {
+            auto const u = queue.front();
+            queue.pop_front();
+            order.push_back(u);
+
+            neighbors.clear();
+            for (auto const& [v, _] : graph.adjacent(u)) {
+                if (!visited[v]) {
+                    visited[v] = true;
+                    neighbors.push_back(v);
+                }
+            }
+
+            std::ranges::sort(neighbors, [&degree](Vertex lhs, Vertex rhs) {
+                return std::pair { degree(lhs), lhs } < std::pair { degree(rhs), rhs };
+            });
+            queue.insert(queue.end(), neighbors.begin(), neighbors.end());
+        }
+    }
+
+    return { order };
+}
+
+Permutation DegreeSort::order(Graph const& graph)
+{
+    std::vector<Vertex> order(graph.vertex_count());
+    std::iota(order.begin(), order.end(), 0);
+    std::ranges::stable_sort(order, std::greater {}, [&graph](Vertex v) { return graph.adjacent(v).size(); });
+    return { order };
+}
+
+Permutation Gorder::order(Graph const& graph)
+{
+    auto const vertex_count = graph.vertex_count();
+    // Common neighbor scores through a hub touch almost every vertex; skipping hubs
+    // keeps the pass close to linear on dense graphs.
+    auto const hub_degree = static_cast<size_t>(std::sqrt(vertex_count)) + 1;
+
+    std::vector<int> score(vertex_count);
+    std::vector<bool> placed(vertex_count);
+    // Max-heap of (score, -vertex) with lazy deletion: an entry is stale
+    // if the vertex is already placed or its score has changed since.
+    std::priority_queue<std::pair<int, Vertex>> heap;
+
+    auto const update = [&](Vertex v, int delta) {
+        if (placed[v]) {
+            return;
+        }
+
+        score[v] += delta;
+        heap.emplace(score[v], -v);
+    };
+
+    // Adds (delta = 1) or removes (delta = -1) the contribution of `u` in the window.
+    auto const updateWindow = [&](Vertex u, int delta) {
+        for (auto const& [v, _] : graph.adjacent(u)) {
+            update(v, delta);
+
+            if (graph.adjacent(v).size() <= hub_degree) {
+                for (auto const& [w, _] : graph.adjacent(v)) {
+                    if (w != u) {
+                        update(w, delta);
+                    }
+                }
+            }
+        }
+    };
+
+    std::vector<Vertex> order;
+    order.reserve(vertex_count);
+
+    auto seed = 0uz;
+    std::vector<Vertex> by_degree(vertex_count);
+    std::iota(by_degree.begin(), by_degree.end(), 0);
+    std::ranges::stable_sort(by_degree, std::greater {}, [&graph](Vertex v) { return graph.adjacent(v).size(); });
+
+    while (order.size() < vertex_count) {
+        auto next = kVertexError;
+
+        while (!heap.empty()) {
+            auto const [entry_score, negated_vertex] = heap.top();
+            heap.pop();
+
+            auto const v = -negated_vertex;
+            if (!placed[v] && score[v] == entry_score && entry_score > 0) {
+                next = v;
+                break;
+            }
+        }
+
+        // Nothing in the window relates to any unplaced vertex: start from the highest degree one.
+        if (next == kVertexError) {
+            while (placed[by_degree[seed]]) {
+                ++seed;
+            }
+            next = by_degree[seed];
+        }
+
+        placed[next] = true;
+        order.push_back(next);
+        updateWindow(next, 1);
+
+        if (order.size() > kWindowSize) {
+            updateWindow(order[order.size() - kWindowSize - 1], -1);
+        }
+    }
+
+    return { order };
+}
+};
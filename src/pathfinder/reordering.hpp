@@ -0,0 +1,82 @@
+#pragma once
+
+#include "graphs.hpp"
+#include "pathfinders.hpp"
+
+#include <vector>
+
+// Vertex reordering passes that improve memory locality of per-vertex arrays
+// (dist, prev, ...) by giving neighboring vertices close ids.
+namespace Reordering {
+using namespace Graphs;
+using Pathfinders::Path;
+
+// Bijection between original and reordered vertex ids.
+class Permutation {
+public:
+    // `order[i]` is the original vertex that gets id `i`.
+    Permutation(std::vector<Vertex> order);
+
+    Vertex toReordered(Vertex original) const;
+    Vertex toOriginal(Vertex reordered) const;
+    Path toOriginal(Path path) const;
+    Graph apply(Graph const& graph) const;
+
+private:
+    std::vector<Vertex> _to_original;
+    std::vector<Vertex> _to_reordered;
+};
+
+// A reordered copy of a graph that answers queries in original vertex ids.
+class ReorderedGraph {
+public:
+    ReorderedGraph(Graph const& graph, Permutation permutation);
+
+    Graph const& graph() const;
+    Permutation const& permutation() const;
+
+    template <class P>
+    Path pathfind(Vertex from, Vertex to) const
+    {
+        return _permutation.toOriginal(P::pathfind(_graph, _permutation.toReordered(from), _permutation.toReordered(to)));
+    }
+
+private:
+    Permutation _permutation;
+    Graph _graph;
+};
+
+// Cuthill-McKee: BFS from a minimum degree vertex, visiting neighbors by increasing degree.
+class CuthillMcKee {
+public:
+    static Permutation order(Graph const& graph);
+    static constexpr inline char const* name()
+    {
+        return "Cuthill-McKee";
+    }
+};
+
+// Vertices sorted by decreasing degree, so that hubs share cache lines.
+class DegreeSort {
+public:
+    static Permutation order(Graph const& graph);
+    static constexpr inline char const* name()
+    {
+        return "Degree-Sort";
+    }
+};
+
+// Greedy Gorder (Wei et al., "Speedup Graph Processing by Graph Ordering", 2016):
+// the next vertex is the one sharing the most edges and common neighbors
+// with the last kWindowSize placed vertices.
+class Gorder {
+public:
+    static constexpr size_t kWindowSize = 5;
+
+    static Permutation order(Graph const& graph);
+    static constexpr inline char const* name()
+    {
+        return "Gorder";
+    }
+};
+};
@@ -0,0 +1,290 @@
+#include "resumable.hpp"
+
+#include <algorithm>
+#include <deque>
+#include <stdexcept>
+#include <utility>
+
+namespace Resumable {
+namespace {
+std::optional<Status> stopReason(Limits const& limits)
+{
+    if (limits.token.cancelled()) {
+        return Status::Cancelled;
+    }
+
+    if (limits.deadline && Clock::now() >= *limits.deadline) {
+        return Status::DeadlineExceeded;
+    }
+
+    return std::nullopt;
+}
+
+Path tracePath(std::vector<DistType> const& dist, Path const& prev, Vertex to)
+{
+    if (dist[to] == kDistInf) {
+        return {};
+    }
+
+    Path path;
+    for (auto v = to; v != kVertexError; v = prev[v]) {
+        path.push_back(v);
+    }
+
+    std::ranges::reverse(path);
+    return path;
+}
+};
+
+CancellationToken::CancellationToken()
+    : _cancelled(std::make_shared<std::atomic<bool>>(false))
+{
+}
+
+void CancellationToken::cancel() const
+{
+    _cancelled->store(true, std::memory_order_relaxed);
+}
+
+bool CancellationToken::cancelled() const
+{
+    return _cancelled->load(std::memory_order_relaxed);
+}
+
+Query Query::promise_type::get_return_object()
+{
+    return Query { std::coroutine_handle<promise_type>::from_promise(*this) };
+}
+
+std::suspend_always Query::promise_type::initial_suspend() noexcept
+{
+    return {};
+}
+
+std::suspend_always Query::promise_type::final_suspend() noexcept
+{
+    return {};
+}
+
+std::suspend_always Query::promise_type::yield_value(DistType best_dist)
+{
+    progress.best_dist = best_dist;
+    return {};
+}
+
+void Query::promise_type::return_value(Progress result)
+{
+    progress = std::move(result);
+}
+
+void Query::promise_type::unhandled_exception()
+{
+    exception = std::current_exception();
+}
+
+Query::Query(std::coroutine_handle<promise_type> handle)
+    : _handle(handle)
+{
+}
+
+Query::Query(Query&& other) noexcept
+    : _handle(std::exchange(other._handle, nullptr))
+{
+}
+
+Query& Query::operator=(Query&& other) noexcept
+{
+    if (this != &other) {
+        if (_handle) {
+            _handle.destroy();
+        }
+        _handle = std::exchange(other._handle, nullptr);
+    }
+
+    return *this;
+}
+
+Query::~Query()
+{
+    if (_handle) {
+        _handle.destroy();
+    }
+}
+
+bool Query::resume()
+{
+    if (done()) {
+        return false;
+    }
+
+    _handle.resume();
+    if (_handle.promise().exception) {
+        std::rethrow_exception(_handle.promise().exception);
+    }
+
+    return !done();
+}
+
+bool Query::done() const
+{
+    return _handle.done();
+}
+
+Progress const& Query::progress() const
+{
+    return _handle.promise().progress;
+}
+
+Query Dijkstra::pathfind(Graph const& graph, Vertex from, Vertex to, Limits limits)
+{
+    if (limits.slice_steps == 0) {
+        throw std::invalid_argument("A slice must do at least one step");
+    }
+
+    std::vector<DistType> dist(graph.vertex_count(), kDistInf);
+    Path prev(graph.vertex_count(), kVertexError);
+    std::vector<bool> settled(graph.vertex_count());
+    auto settled_count = 0uz;
+
+    dist.at(from) = 0;
+
+    auto const stop = [&](Status status) {
+        Progress result { .status = status, .best_dist = dist[to], .path = tracePath(dist, prev, to), .settled_count = settled_count };
+        if (status != Status::Finished) {
+            for (auto v = 0uz; v < graph.vertex_count(); ++v) {
+                if (!settled[v] && dist[v] != kDistInf) {
+                    result.frontier.push_back(v);
+                }
+            }
+        }
+        return result;
+    };
+
+    for (;;) {
+        if (auto const reason = stopReason(limits)) {
+            co_return stop(*reason);
+        }
+
+        for (auto steps = 0uz; steps < limits.slice_steps; ++steps) {
+            auto u = kVertexError;
+            for (auto v = 0uz; v < graph.vertex_count(); ++v) {
+                if (!settled[v] && dist[v] != kDistInf && (u == kVertexError || dist[v] < dist[u])) {
+                    u = v;
+                }
+            }
+
+            if (u == kVertexError || u == to) {
+                co_return stop(Status::Finished);
+            }
+
+            settled[u] = true;
+            ++settled_count;
+
+            for (auto const& [v, weight] : graph.adjacent(u)) {
+                if (!settled[v] && dist[u] + weight < dist[v]) {
+                    dist[v] = dist[u] + weight;
+                    prev[v] = u;
+                }
+            }
+        }
+
+        if (auto const reason = stopReason(limits)) {
+            co_return stop(*reason);
+        }
+
+        co_yield dist[to];
+    }
+}
+
+Query SPFA::pathfind(Graph const& graph, Vertex from, Vertex to, Limits limits)
+{
+    if (limits.slice_steps == 0) {
+        throw std::invalid_argument("A slice must do at least one step");
+    }
+
+    std::vector<DistType> dist(graph.vertex_count(), kDistInf);
+    Path prev(graph.vertex_count(), kVertexError);
+    std::deque<Vertex> queue = { from };
+    auto settled_count = 0uz;
+
+    dist.at(from) = 0;
+
+    auto const stop = [&](Status status) {
+        Progress result { .status = status, .best_dist = dist[to], .path = tracePath(dist, prev, to), .settled_count = settled_count };
+        if (status != Status::Finished) {
+            result.frontier.assign(queue.begin(), queue.end());
+        }
+        return result;
+    };
+
+    for (;;) {
+        if (auto const reason = stopReason(limits)) {
+            co_return stop(*reason);
+        }
+
+        // A vertex's relaxations are never split between slices, so a slice may run a bit over.
+        auto steps = 0uz;
+        while (steps < limits.slice_steps && !queue.empty()) {
+            auto const u = queue.front();
+            queue.pop_front();
+            ++settled_count;
+
+            for (auto const& [v, weight] : graph.adjacent(u)) {
+                ++steps;
+                auto const alt = dist[u] + weight;
+                if (dist[v] > alt) {
+                    dist[v] = alt;
+                    prev[v] = u;
+                    if (!std::ranges::contains(queue, v)) {
+                        queue.push_back(v);
+                    }
+                }
+            }
+        }
+
+        if (queue.empty()) {
+            co_return stop(Status::Finished);
+        }
+
+        if (auto const reason = stopReason(limits)) {
+            co_return stop(*reason);
+        }
+
+        co_yield dist[to];
+    }
+}
+
+Scheduler::QueryId Scheduler::submit(Query query)
+{
+    _queries.push_back(std::move(query));
+    return _queries.size() - 1;
+}
+
+size_t Scheduler::step()
+{
+    auto running = 0uz;
+
+    for (auto& query : _queries) {
+        if (query.resume()) {
+            ++running;
+        }
+    }
+
+    return running;
+}
+
+void Scheduler::run()
+{
+    while (step() != 0) { }
+}
+
+bool Scheduler::done(QueryId id) const
+{
+    return _queries.at(id).done();
+}
+
+Progress const& Scheduler::progress(QueryId id) const
+{
+    return _queries.at(id).progress();
+}
+};
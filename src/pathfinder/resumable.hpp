@@ -0,0 +1,132 @@
+#pragma once
+
+#include "graphs.hpp"
+#include "pathfinders.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <coroutine>
+#include <exception>
+#include <memory>
+#include <optional>
+#include <vector>
+
+// Coroutine-based pathfinders that run in time slices and can be stopped early.
+namespace Resumable {
+using namespace Graphs;
+using Pathfinders::Path;
+using Clock = std::chrono::steady_clock;
+
+// Shared stop flag: copies observe the same state, so the caller keeps one copy
+// and hands another to the query.
+class CancellationToken {
+public:
+    CancellationToken();
+
+    void cancel() const;
+    bool cancelled() const;
+
+private:
+    std::shared_ptr<std::atomic<bool>> _cancelled;
+};
+
+struct Limits {
+    // Work done between two suspensions: settled vertices for Dijkstra, relaxations for SPFA.
+    // Must be positive: otherwise the first resume() throws std::invalid_argument.
+    size_t slice_steps = 256;
+    // Checked at slice boundaries, so it may be overrun by up to one slice.
+    std::optional<Clock::time_point> deadline {};
+    CancellationToken token {};
+};
+
+enum class Status {
+    Running,
+    Finished,
+    Cancelled,
+    DeadlineExceeded
+};
+
+struct Progress {
+    Status status = Status::Running;
+    // Best known distance to the target, kDistInf if it hasn't been reached yet.
+    DistType best_dist = kDistInf;
+    // Best known path to the target (empty if it hasn't been reached yet).
+    // Filled when the query stops.
+    Path path {};
+    // Vertices settled (Dijkstra) or taken from the queue (SPFA) so far.
+    size_t settled_count = 0;
+    // Unfinished work when the query stopped early: tentatively reached but not settled
+    // vertices for Dijkstra, queued vertices for SPFA.
+    std::vector<Vertex> frontier {};
+};
+
+// A suspended pathfinding query. Created suspended; every resume() runs one slice.
+class Query {
+public:
+    struct promise_type {
+        Progress progress {};
+        std::exception_ptr exception {};
+
+        Query get_return_object();
+        std::suspend_always initial_suspend() noexcept;
+        std::suspend_always final_suspend() noexcept;
+        std::suspend_always yield_value(DistType best_dist);
+        void return_value(Progress result);
+        void unhandled_exception();
+    };
+
+    Query(Query&& other) noexcept;
+    Query& operator=(Query&& other) noexcept;
+    Query(Query const&) = delete;
+    Query& operator=(Query const&) = delete;
+    ~Query();
+
+    // Runs one slice, rethrowing anything the query has thrown.
+    // Returns whether the query still has work to do.
+    bool resume();
+    bool done() const;
+    Progress const& progress() const;
+
+private:
+    explicit Query(std::coroutine_handle<promise_type> handle);
+
+    std::coroutine_handle<promise_type> _handle;
+};
+
+// The graph must outlive the queries created from it.
+class Dijkstra {
+public:
+    static Query pathfind(Graph const& graph, Vertex from, Vertex to, Limits limits = {});
+    static constexpr inline char const* name()
+    {
+        return "Resumable-Dijkstra";
+    }
+};
+
+class SPFA {
+public:
+    static Query pathfind(Graph const& graph, Vertex from, Vertex to, Limits limits = {});
+    static constexpr inline char const* name()
+    {
+        return "Resumable-SPFA";
+    }
+};
+
+// Cooperative round-robin scheduler: interleaves the slices of many queries on the calling thread.
+class Scheduler {
+public:
+    using QueryId = size_t;
+
+    QueryId submit(Query query);
+    // Resumes every unfinished query once. Returns how many are still unfinished.
+    size_t step();
+    // Steps until every query is finished.
+    void run();
+
+    bool done(QueryId id) const;
+    Progress const& progress(QueryId id) const;
+
+private:
+    std::vector<Query> _queries;
+};
+};
@@ -1,13 +1,21 @@
 #include "tester.hpp"
 #include "util.hpp"
 
+#include <algorithm>
+#include <any>
+#include <cmath>
 #include <iostream>
+#include <numeric>
+#include <string>
+#include <type_traits>
 
 void Tester::runTests(std::ostream& output_stream, size_t test_repeat_count, size_t endpoints_generation_repeat_count)
 {
-    output_stream << "graph_type,vertex_count,edge_count,pathfinder,time_nanos\n";
+    output_stream << "graph_type,vertex_count,edge_count,pathfinder,time_nanos,samples,stddev_nanos,p50_nanos,p90_nanos,p99_nanos,prepare_nanos\n";
 
-    std::vector<TestResult> test_results(_pathfinders.size());
+    std::vector<std::vector<TestResult>> test_results(_pathfinders.size());
+    // Distance-only queries of the pathfinders that provide `distance(index, from, to)`.
+    std::vector<std::vector<TestResult>> distance_results(_pathfinders.size());
     auto current_test_number = 0;
     auto const total_test_count = _graphGenerators.size()
         * ((kMaxVertexCount - kMinVertexCount) / kVertexCountStep + 1)
@@ -17,32 +25,84 @@ void Tester::runTests(std::ostream& output_stream, size_t test_repeat_count, siz
         for (auto vertex_count = kMinVertexCount; vertex_count <= kMaxVertexCount; vertex_count += kVertexCountStep) {
             auto const graph = std::visit([vertex_count](auto&& g) { return g.generate(vertex_count); }, graph_generator);
             auto const graph_name = std::visit([](auto&& g) { return g.name(); }, graph_generator);
-            std::ranges::fill(test_results, TestResult {});
+            for (auto& samples : test_results) {
+                samples.clear();
+                samples.reserve(endpoints_generation_repeat_count * test_repeat_count);
+            }
+            for (auto& samples : distance_results) {
+                samples.clear();
+            }
+
+            std::vector<bool> applicable;
+            applicable.reserve(_pathfinders.size());
+            for (auto const& pathfinder : _pathfinders) {
+                applicable.push_back(isApplicable(pathfinder, graph));
+            }
+
+            // Pathfinders that provide `prepare(graph)` get their index built once per graph,
+            // so that only the queries themselves are sampled below.
+            std::vector<std::any> prepared(_pathfinders.size());
+            std::vector<TestResult> prepare_times(_pathfinders.size());
+            for (auto pathfinder_index = 0uz; pathfinder_index < _pathfinders.size(); ++pathfinder_index) {
+                if (!applicable[pathfinder_index]) {
+                    continue;
+                }
+
+                std::visit([&, pathfinder_index](auto&& p) {
+                    if constexpr (requires { p.prepare(graph); }) {
+                        prepare_times[pathfinder_index] = measure([&] { p.prepare(graph); }, test_repeat_count);
+                        prepared[pathfinder_index] = p.prepare(graph);
+                    }
+                },
+                    _pathfinders[pathfinder_index]);
+            }
 
             for (auto endpoints_i = 0uz; endpoints_i < endpoints_generation_repeat_count; ++endpoints_i) {
                 auto const from = util::getRandomNumber(0uz, graph.vertex_count() - 1);
                 auto const to = util::getRandomNumber(0uz, graph.vertex_count() - 1);
 
                 for (auto pathfinder_index = 0uz; pathfinder_index < _pathfinders.size(); ++pathfinder_index) {
+                    if (!applicable[pathfinder_index]) {
+                        continue;
+                    }
+
                     auto const& pathfinder = _pathfinders[pathfinder_index];
 
-                    auto const result = std::visit([&graph, from, to, test_repeat_count](auto&& p) {
-                        TestResult test_result {};
+                    auto& samples = test_results[pathfinder_index];
+                    auto& distance_samples = distance_results[pathfinder_index];
+                    auto const& prepared_index = prepared[pathfinder_index];
+                    std::visit([&graph, from, to, test_repeat_count, &samples, &distance_samples, &prepared_index](auto&& p) {
+                        if constexpr (requires { p.prepare(graph); }) {
+                            auto const& index = std::any_cast<decltype(p.prepare(graph)) const&>(prepared_index);
 
-                        for (auto i = 0uz; i < test_repeat_count; ++i) {
-                            auto const start = std::chrono::high_resolution_clock::now();
-                            p.pathfind(graph, from, to);
-                            auto const end = std::chrono::high_resolution_clock::now();
+                            for (auto i = 0uz; i < test_repeat_count; ++i) {
+                                auto const start = std::chrono::high_resolution_clock::now();
+                                p.pathfind(index, from, to);
+                                auto const end = std::chrono::high_resolution_clock::now();
 
-                            test_result += std::chrono::duration_cast<TestResult>(end - start);
-                        }
+                                samples.push_back(std::chrono::duration_cast<TestResult>(end - start));
+                            }
+
+                            if constexpr (requires { p.distance(index, from, to); }) {
+                                for (auto i = 0uz; i < test_repeat_count; ++i) {
+                                    auto const start = std::chrono::high_resolution_clock::now();
+                                    p.distance(index, from, to);
+                                    auto const end = std::chrono::high_resolution_clock::now();
+
+                                    distance_samples.push_back(std::chrono::duration_cast<TestResult>(end - start));
+                                }
+                            }
+                        } else {
+                            for (auto i = 0uz; i < test_repeat_count; ++i) {
+                                auto const start = std::chrono::high_resolution_clock::now();
+                                p.pathfind(graph, from, to);
+                                auto const end = std::chrono::high_resolution_clock::now();
 
-                        test_result /= test_repeat_count;
-                        return test_result;
+                                samples.push_back(std::chrono::duration_cast<TestResult>(end - start));
+                            }
+                        }
                     },
                         pathfinder);
-
-                    test_results[pathfinder_index] += result;
                 }
             }
 
@@ -50,8 +110,6 @@ void Tester::runTests(std::ostream& output_stream, size_t test_repeat_count, siz
                 auto const& pathfinder = _pathfinders[pathfinder_index];
                 auto const pathfinder_name = std::visit([](auto&& p) { return p.name(); }, pathfinder);
 
-                auto const result = test_results[pathfinder_index] / endpoints_generation_repeat_count;
-
                 std::cout << "Test -> " << ++current_test_number << '/' << total_test_count << '\t'
                           << "Graph: [type=" << graph_name
                           << ", vertices=" << graph.vertex_count()
@@ -59,17 +117,353 @@ void Tester::runTests(std::ostream& output_stream, size_t test_repeat_count, siz
                           << pathfinder_name << " pathfinder"
                           << '\n';
 
+                if (!applicable[pathfinder_index]) {
+                    std::cout << "\t\t\t---> Skipped: not applicable to this graph\n";
+                    continue;
+                }
+
+                auto const report = [&](std::string const& name, std::vector<TestResult>& samples) {
+                    auto const result = summarize(samples);
+
+                    output_stream << graph_name << ','
+                                  << vertex_count << ','
+                                  << graph.edge_count() << ','
+                                  << name << ','
+                                  << result.mean.count() << ','
+                                  << result.samples << ','
+                                  << result.stddev.count() << ','
+                                  << result.p50.count() << ','
+                                  << result.p90.count() << ','
+                                  << result.p99.count() << ','
+                                  << prepare_times[pathfinder_index].count()
+                                  << '\n';
+
+                    std::cout << "\t\t\t---> " << name << ": "
+                              << result.mean.count() << "ns"
+                              << " (p99: " << result.p99.count() << "ns"
+                              << ", prepare: " << prepare_times[pathfinder_index].count() << "ns)"
+                              << '\n';
+                };
+
+                report(pathfinder_name, test_results[pathfinder_index]);
+                if (!distance_results[pathfinder_index].empty()) {
+                    report(std::string { pathfinder_name } + "-Distance", distance_results[pathfinder_index]);
+                }
+            }
+        }
+    }
+}
+
+void Tester::runReorderingTests(std::ostream& output_stream, size_t test_repeat_count, size_t endpoints_generation_repeat_count)
+{
+    output_stream << "graph_type,vertex_count,edge_count,ordering,pathfinder,reorder_nanos,baseline_nanos,time_nanos,speedup\n";
+
+    for (auto const& graph_generator : _graphGenerators) {
+        for (auto vertex_count = kMinVertexCount; vertex_count <= kMaxVertexCount; vertex_count += kVertexCountStep) {
+            auto const graph = std::visit([vertex_count](auto&& g) { return g.generate(vertex_count); }, graph_generator);
+            auto const graph_name = std::visit([](auto&& g) { return g.name(); }, graph_generator);
+
+            std::vector<std::pair<Graphs::Vertex, Graphs::Vertex>> endpoints(endpoints_generation_repeat_count);
+            for (auto& [from, to] : endpoints) {
+                from = util::getRandomNumber(0uz, graph.vertex_count() - 1);
+                to = util::getRandomNumber(0uz, graph.vertex_count() - 1);
+            }
+
+            std::vector<TestResult> baseline(_pathfinders.size());
+            for (auto pathfinder_index = 0uz; pathfinder_index < _pathfinders.size(); ++pathfinder_index) {
+                auto const& pathfinder = _pathfinders[pathfinder_index];
+                if (!isApplicable(pathfinder, graph)) {
+                    continue;
+                }
+
+                for (auto const& [from, to] : endpoints) {
+                    baseline[pathfinder_index] += std::visit([&graph, from, to, test_repeat_count](auto&& p) {
+                        return measure([&] { p.pathfind(graph, from, to); }, test_repeat_count);
+                    },
+                        pathfinder);
+                }
+                baseline[pathfinder_index] /= endpoints.size();
+            }
+
+            for (auto const& ordering : _orderings) {
+                auto const ordering_name = std::visit([](auto&& o) { return o.name(); }, ordering);
+                auto const reorder_cost = std::visit([&graph, test_repeat_count](auto&& o) {
+                    return measure([&] { Reordering::ReorderedGraph { graph, o.order(graph) }; }, test_repeat_count);
+                },
+                    ordering);
+                auto const reordered = std::visit([&graph](auto&& o) { return Reordering::ReorderedGraph { graph, o.order(graph) }; }, ordering);
+
+                std::cout << "Reordering -> Graph: [type=" << graph_name
+                          << ", vertices=" << graph.vertex_count()
+                          << ", edges=" << graph.edge_count() << "] + "
+                          << ordering_name << " ordering: "
+                          << reorder_cost.count() << "ns"
+                          << '\n';
+
+                for (auto pathfinder_index = 0uz; pathfinder_index < _pathfinders.size(); ++pathfinder_index) {
+                    auto const& pathfinder = _pathfinders[pathfinder_index];
+                    if (!isApplicable(pathfinder, graph)) {
+                        continue;
+                    }
+
+                    TestResult result {};
+                    for (auto const& [from, to] : endpoints) {
+                        result += std::visit([&reordered, from, to, test_repeat_count](auto&& p) {
+                            using P = std::remove_cvref_t<decltype(p)>;
+                            return measure([&] { reordered.pathfind<P>(from, to); }, test_repeat_count);
+                        },
+                            pathfinder);
+                    }
+                    result /= endpoints.size();
+
+                    auto const pathfinder_name = std::visit([](auto&& p) { return p.name(); }, pathfinder);
+                    auto const speedup = result.count() != 0
+                        ? static_cast<double>(baseline[pathfinder_index].count()) / result.count()
+                        : 0.0;
+
+                    output_stream << graph_name << ','
+                                  << vertex_count << ','
+                                  << graph.edge_count() << ','
+                                  << ordering_name << ','
+                                  << pathfinder_name << ','
+                                  << reorder_cost.count() << ','
+                                  << baseline[pathfinder_index].count() << ','
+                                  << result.count() << ','
+                                  << speedup
+                                  << '\n';
+
+                    std::cout << "\t\t\t---> " << pathfinder_name << ": "
+                              << baseline[pathfinder_index].count() << "ns -> "
+                              << result.count() << "ns (x" << speedup << ")"
+                              << '\n';
+                }
+            }
+        }
+    }
+}
+
+void Tester::runCompressionTests(std::ostream& output_stream, size_t test_repeat_count, size_t endpoints_generation_repeat_count)
+{
+    output_stream << "graph_type,vertex_count,edge_count,representation,bytes_per_edge,scan_nanos,edges_per_second,spfa_nanos\n";
+
+    for (auto const& graph_generator : _graphGenerators) {
+        for (auto vertex_count = kMinVertexCount; vertex_count <= kMaxVertexCount; vertex_count += kVertexCountStep) {
+            auto const graph = std::visit([vertex_count](auto&& g) { return g.generate(vertex_count); }, graph_generator);
+            auto const graph_name = std::visit([](auto&& g) { return g.name(); }, graph_generator);
+            Graphs::CompressedGraph const compressed { graph };
+
+            std::vector<std::pair<Graphs::Vertex, Graphs::Vertex>> endpoints(endpoints_generation_repeat_count);
+            for (auto& [from, to] : endpoints) {
+                from = util::getRandomNumber(0uz, graph.vertex_count() - 1);
+                to = util::getRandomNumber(0uz, graph.vertex_count() - 1);
+            }
+
+            auto const report = [&](char const* representation, auto const& g, size_t byte_size) {
+                // Touches every (neighbor, weight) pair; the volatile sink keeps the loop alive.
+                volatile Graphs::DistType sink = 0;
+                auto const scan = measure([&] {
+                    Graphs::DistType sum = 0;
+                    for (auto u = 0uz; u < g.vertex_count(); ++u) {
+                        for (auto const& [v, weight] : g.adjacent(u)) {
+                            sum += v + weight;
+                        }
+                    }
+                    sink = sum;
+                },
+                    test_repeat_count);
+
+                TestResult spfa {};
+                for (auto const& [from, to] : endpoints) {
+                    spfa += measure([&] { Pathfinders::SPFA::pathfind(g, from, to); }, test_repeat_count);
+                }
+                spfa /= endpoints.size();
+
+                // Both directions of an undirected edge are stored.
+                auto const stored_edge_count = 2 * g.edge_count();
+                auto const bytes_per_edge = static_cast<double>(byte_size) / stored_edge_count;
+                auto const edges_per_second = scan.count() != 0 ? stored_edge_count * 1e9 / scan.count() : 0.0;
+
+                std::cout << "Compression -> Graph: [type=" << graph_name
+                          << ", vertices=" << graph.vertex_count()
+                          << ", edges=" << graph.edge_count() << "] + "
+                          << representation << " representation: "
+                          << bytes_per_edge << " bytes/edge, "
+                          << edges_per_second << " edges/s, SPFA "
+                          << spfa.count() << "ns"
+                          << '\n';
+
                 output_stream << graph_name << ','
                               << vertex_count << ','
                               << graph.edge_count() << ','
-                              << pathfinder_name << ','
-                              << result.count()
+                              << representation << ','
+                              << bytes_per_edge << ','
+                              << scan.count() << ','
+                              << edges_per_second << ','
+                              << spfa.count()
                               << '\n';
+            };
 
-                std::cout << "\t\t\t---> Result: "
-                          << result.count() << "ns"
+            report("Std", graph, graph.byte_size());
+            report("Compressed", compressed, compressed.byte_size());
+        }
+    }
+}
+
+void Tester::runQueryTests(std::ostream& output_stream, size_t test_repeat_count, size_t endpoints_generation_repeat_count)
+{
+    output_stream << "graph_type,vertex_count,edge_count,query,early_stop_nanos,full_sssp_nanos,speedup,settled_vertices\n";
+
+    for (auto const& graph_generator : _graphGenerators) {
+        for (auto vertex_count = kMinVertexCount; vertex_count <= kMaxVertexCount; vertex_count += kVertexCountStep) {
+            auto const graph = std::visit([vertex_count](auto&& g) { return g.generate(vertex_count); }, graph_generator);
+            auto const graph_name = std::visit([](auto&& g) { return g.name(); }, graph_generator);
+
+            std::array<TestResult, kQueryRadiusPercentiles.size()> radius_time {};
+            std::array<TestResult, kQueryRadiusPercentiles.size()> radius_baseline {};
+            std::array<size_t, kQueryRadiusPercentiles.size()> radius_settled {};
+            TestResult targets_time {};
+            TestResult targets_baseline {};
+            auto targets_settled = 0uz;
+
+            for (auto endpoints_i = 0uz; endpoints_i < endpoints_generation_repeat_count; ++endpoints_i) {
+                Graphs::Vertex const source = util::getRandomNumber(0uz, graph.vertex_count() - 1);
+                std::vector<Graphs::Vertex> targets(kQueryTargetCount);
+                for (auto& target : targets) {
+                    target = util::getRandomNumber(0uz, graph.vertex_count() - 1);
+                }
+
+                // Radii are taken from the distances actually reachable from this source.
+                std::vector<Graphs::DistType> source_dists;
+                for (auto const d : Queries::AllDistances::query(graph, source)) {
+                    if (d != Graphs::kDistInf) {
+                        source_dists.push_back(d);
+                    }
+                }
+                std::ranges::sort(source_dists);
+
+                for (auto percentile_i = 0uz; percentile_i < kQueryRadiusPercentiles.size(); ++percentile_i) {
+                    auto const radius = source_dists[kQueryRadiusPercentiles[percentile_i] * (source_dists.size() - 1) / 100];
+
+                    radius_time[percentile_i] += measure([&] { Queries::Radius::query(graph, source, radius); }, test_repeat_count);
+                    radius_baseline[percentile_i] += measure([&] {
+                        auto const dist = Queries::AllDistances::query(graph, source);
+                        Queries::Reached reached;
+                        for (auto v = 0uz; v < dist.size(); ++v) {
+                            if (dist[v] <= radius) {
+                                reached.vertices.push_back(v);
+                                reached.dists.push_back(dist[v]);
+                            }
+                        }
+                    },
+                        test_repeat_count);
+                    radius_settled[percentile_i] += Queries::Radius::query(graph, source, radius).vertices.size();
+                }
+
+                targets_time += measure([&] { Queries::OneToMany::query(graph, source, targets); }, test_repeat_count);
+                targets_baseline += measure([&] {
+                    auto const dist = Queries::AllDistances::query(graph, source);
+                    std::vector<Graphs::DistType> dists;
+                    dists.reserve(targets.size());
+                    for (auto const target : targets) {
+                        dists.push_back(dist[target]);
+                    }
+                },
+                    test_repeat_count);
+                targets_settled += Queries::OneToMany::query(graph, source, targets).settled;
+            }
+
+            auto const report = [&](std::string const& query_name, TestResult time, TestResult baseline, size_t settled) {
+                time /= endpoints_generation_repeat_count;
+                baseline /= endpoints_generation_repeat_count;
+                settled /= endpoints_generation_repeat_count;
+                auto const speedup = time.count() != 0 ? static_cast<double>(baseline.count()) / time.count() : 0.0;
+
+                std::cout << "Query -> Graph: [type=" << graph_name
+                          << ", vertices=" << graph.vertex_count()
+                          << ", edges=" << graph.edge_count() << "] + "
+                          << query_name << " query: "
+                          << time.count() << "ns vs full SSSP "
+                          << baseline.count() << "ns (x" << speedup << "), "
+                          << settled << " vertices settled"
                           << '\n';
+
+                output_stream << graph_name << ','
+                              << vertex_count << ','
+                              << graph.edge_count() << ','
+                              << query_name << ','
+                              << time.count() << ','
+                              << baseline.count() << ','
+                              << speedup << ','
+                              << settled
+                              << '\n';
+            };
+
+            for (auto percentile_i = 0uz; percentile_i < kQueryRadiusPercentiles.size(); ++percentile_i) {
+                report(std::string { Queries::Radius::name() } + "-p" + std::to_string(kQueryRadiusPercentiles[percentile_i]),
+                    radius_time[percentile_i], radius_baseline[percentile_i], radius_settled[percentile_i]);
             }
+            report(Queries::OneToMany::name(), targets_time, targets_baseline, targets_settled);
+        }
+    }
+}
+
+template <class F>
+Tester::TestResult Tester::measure(F&& f, size_t repeat_count)
+{
+    TestResult result {};
+
+    for (auto i = 0uz; i < repeat_count; ++i) {
+        auto const start = std::chrono::high_resolution_clock::now();
+        f();
+        auto const end = std::chrono::high_resolution_clock::now();
+
+        result += std::chrono::duration_cast<TestResult>(end - start);
+    }
+
+    return result / repeat_count;
+}
+
+bool Tester::isApplicable(PathfinderTs const& pathfinder, Graphs::Graph const& graph)
+{
+    return std::visit([&graph](auto&& p) {
+        if constexpr (requires { p.accepts(graph); }) {
+            return p.accepts(graph);
+        } else {
+            return true;
         }
+    },
+        pathfinder);
+}
+
+Tester::TestSummary Tester::summarize(std::vector<TestResult>& samples)
+{
+    TestSummary summary {};
+    summary.samples = samples.size();
+    if (samples.empty()) {
+        return summary;
+    }
+
+    std::ranges::sort(samples);
+    auto const total = std::accumulate(samples.begin(), samples.end(), TestResult {});
+    summary.mean = total / samples.size();
+
+    if (samples.size() > 1) {
+        auto squares_sum = 0.0;
+        for (auto const sample : samples) {
+            auto const deviation = static_cast<double>(sample.count() - summary.mean.count());
+            squares_sum += deviation * deviation;
+        }
+        summary.stddev = TestResult { static_cast<TestResult::rep>(std::sqrt(squares_sum / (samples.size() - 1))) };
     }
-}
\ No newline at end of file
+
+    // Nearest-rank percentiles.
+    auto const percentile = [&samples](double p) {
+        auto const rank = static_cast<size_t>(std::ceil(p * samples.size()));
+        return samples[std::clamp(rank, 1uz, samples.size()) - 1];
+    };
+    summary.p50 = percentile(0.5);
+    summary.p90 = percentile(0.9);
+    summary.p99 = percentile(0.99);
+
+    return summary;
+}
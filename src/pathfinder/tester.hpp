@@ -1,8 +1,12 @@
 #pragma once
 
+#include "compressed_graph.hpp"
 #include "graphs.hpp"
 #include "pathfinders.hpp"
+#include "queries.hpp"
+#include "reordering.hpp"
 
+#include <array>
 #include <chrono>
 #include <ostream>
 #include <variant>
@@ -11,21 +15,54 @@
 class Tester {
 public:
     void runTests(std::ostream& output_stream, size_t test_repeat_count, size_t endpoints_generation_repeat_count);
+    // Measures vertex reordering cost and the pathfinders' speedup on reordered graphs.
+    void runReorderingTests(std::ostream& output_stream, size_t test_repeat_count, size_t endpoints_generation_repeat_count);
+    // Compares the hash map and the compressed graph representations: bytes per edge,
+    // full adjacency scan throughput and SPFA time.
+    void runCompressionTests(std::ostream& output_stream, size_t test_repeat_count, size_t endpoints_generation_repeat_count);
+    // Compares early-stopping radius and one-to-many queries with full SSSP plus filtering.
+    void runQueryTests(std::ostream& output_stream, size_t test_repeat_count, size_t endpoints_generation_repeat_count);
 
 private:
     using TestResult = std::chrono::nanoseconds;
+
+    struct TestSummary {
+        size_t samples;
+        TestResult mean;
+        TestResult stddev;
+        TestResult p50;
+        TestResult p90;
+        TestResult p99;
+    };
+
     using GraphGeneratorTs = std::variant<Graphs::Full, Graphs::Partial, Graphs::Tree>;
-    using PathfinderTs = std::variant<Pathfinders::Dijkstra, Pathfinders::FloydWarshall, Pathfinders::BellmanFord, Pathfinders::SPFA>;
+    using OrderingTs = std::variant<Reordering::CuthillMcKee, Reordering::DegreeSort, Reordering::Gorder>;
+    using PathfinderTs = std::variant<Pathfinders::Dijkstra, Pathfinders::FloydWarshall, Pathfinders::BellmanFord, Pathfinders::SPFA, Pathfinders::ParallelSPFA, Pathfinders::TreeLCA>;
 
     static constexpr auto kMinVertexCount = 10uz;
     static constexpr auto kMaxVertexCount = 1010uz;
     static constexpr auto kVertexCountStep = 50uz;
+    // Radius queries are swept over these percentiles of the source's distances,
+    // so that they stop early on every graph type and size.
+    static constexpr std::array kQueryRadiusPercentiles = { 10uz, 50uz, 90uz };
+    static constexpr auto kQueryTargetCount = 8uz;
+
+    // Pathfinders restricted to some topology (e.g. trees) provide `accepts(graph)`.
+    static bool isApplicable(PathfinderTs const& pathfinder, Graphs::Graph const& graph);
+    // Average time of `repeat_count` calls of `f`.
+    template <class F>
+    static TestResult measure(F&& f, size_t repeat_count);
+    // Sorts the samples in place.
+    static TestSummary summarize(std::vector<TestResult>& samples);
 
     std::vector<GraphGeneratorTs> _graphGenerators = { Graphs::Full {}, Graphs::Partial {}, Graphs::Tree {} };
     std::vector<PathfinderTs> _pathfinders = {
         Pathfinders::Dijkstra {},
         Pathfinders::FloydWarshall {},
         Pathfinders::BellmanFord {},
-        Pathfinders::SPFA {}
+        Pathfinders::SPFA {},
+        Pathfinders::ParallelSPFA {},
+        Pathfinders::TreeLCA {}
     };
+    std::vector<OrderingTs> _orderings = { Reordering::CuthillMcKee {}, Reordering::DegreeSort {}, Reordering::Gorder {} };
 };
@@ -3,10 +3,19 @@
 #include <concepts>
 #include <iterator>
 #include <random>
+#include <sstream>
+#include <string>
 
 namespace util {
-static std::default_random_engine random_engine { std::random_device {}() };
-static std::uniform_real_distribution<> random_distribution;
+// Shared by all translation units so that seeding it makes every run reproducible.
+inline std::default_random_engine random_engine { std::random_device {}() };
+inline std::uniform_real_distribution<> random_distribution;
+
+inline void seedRandom(std::default_random_engine::result_type seed)
+{
+    random_engine.seed(seed);
+    random_distribution.reset();
+}
 
 template <class T>
     requires std::integral<T>
@@ -23,4 +32,30 @@ constexpr T getRandomNumber(T min, T max)
     auto const value = random_distribution(random_engine);
     return min + (max - min) * value;
 }
+
+template <class T>
+T parseArg(int argc, char const** argv, const std::string& arg_prefix, T const& default_value)
+{
+    for (int i = 0; i < argc; ++i) {
+        std::string arg { argv[i] };
+        if (arg.starts_with(arg_prefix)) {
+            const std::string to_parse = arg.substr(arg_prefix.size());
+            if (to_parse.empty()) {
+                return default_value;
+            }
+
+            std::stringstream stream_to_parse { to_parse };
+            T value;
+            stream_to_parse >> value;
+
+            if (stream_to_parse.fail()) {
+                return default_value;
+            }
+
+            return value;
+        }
+    }
+
+    return default_value;
+}
 }
\ No newline at end of file
@@ -0,0 +1,86 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cstdint>
+#include <optional>
+#include <type_traits>
+#include <vector>
+
+namespace util {
+// Bounded Chase-Lev work-stealing deque (Lê et al., "Correct and Efficient
+// Work-Stealing for Weak Memory Models", 2013).
+// The owner thread pushes and pops at the bottom, other threads steal from the top.
+// The buffer never grows: the caller must guarantee that no more than `capacity`
+// items are stored at the same time.
+template <class T>
+    requires std::is_trivially_copyable_v<T>
+class WorkStealingDeque {
+public:
+    explicit WorkStealingDeque(size_t capacity)
+        : _buffer(std::bit_ceil(std::max(capacity, 1uz)))
+        , _mask(_buffer.size() - 1)
+    {
+    }
+
+    // Owner only.
+    void push(T item)
+    {
+        auto const bottom = _bottom.load(std::memory_order_relaxed);
+        _buffer[bottom & _mask].store(item, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        _bottom.store(bottom + 1, std::memory_order_relaxed);
+    }
+
+    // Owner only.
+    std::optional<T> pop()
+    {
+        auto const bottom = _bottom.load(std::memory_order_relaxed) - 1;
+        _bottom.store(bottom, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        auto top = _top.load(std::memory_order_relaxed);
+
+        if (top > bottom) {
+            _bottom.store(bottom + 1, std::memory_order_relaxed);
+            return std::nullopt;
+        }
+
+        std::optional<T> item = _buffer[bottom & _mask].load(std::memory_order_relaxed);
+        if (top == bottom) {
+            // The last item: race against thieves for it.
+            if (!_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+                item.reset();
+            }
+            _bottom.store(bottom + 1, std::memory_order_relaxed);
+        }
+
+        return item;
+    }
+
+    // Any thread.
+    std::optional<T> steal()
+    {
+        auto top = _top.load(std::memory_order_acquire);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        auto const bottom = _bottom.load(std::memory_order_acquire);
+
+        if (top >= bottom) {
+            return std::nullopt;
+        }
+
+        auto const item = _buffer[top & _mask].load(std::memory_order_relaxed);
+        if (!_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+            return std::nullopt;
+        }
+
+        return item;
+    }
+
+private:
+    std::vector<std::atomic<T>> _buffer;
+    size_t const _mask;
+    alignas(64) std::atomic<int64_t> _top { 0 };
+    alignas(64) std::atomic<int64_t> _bottom { 0 };
+};
+}
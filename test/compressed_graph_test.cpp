@@ -0,0 +1,61 @@
+#include "../src/pathfinder/compressed_graph.hpp"
+#include "../src/pathfinder/pathfinders.hpp"
+#include "test_util.hpp"
+#include <iostream>
+#include <map>
+
+using namespace Graphs;
+
+template <class G>
+bool testCompression(size_t vertex_count)
+{
+    auto const graph = G::generate(vertex_count);
+    CompressedGraph const compressed { graph };
+
+    if (compressed.vertex_count() != graph.vertex_count() || compressed.edge_count() != graph.edge_count()) {
+        std::cout << "Size mismatch: " << G::name() << " graph\n";
+        return false;
+    }
+
+    for (auto const& [u, edges] : graph) {
+        std::map<Vertex, DistType> const expected(edges.begin(), edges.end());
+        std::map<Vertex, DistType> decoded;
+        for (auto const [v, weight] : compressed.adjacent(u)) {
+            decoded[v] = weight;
+        }
+
+        if (decoded != expected || compressed.adjacent(u).size() != edges.size()) {
+            std::cout << "Adjacency mismatch: " << G::name() << " graph, vertex " << u << '\n';
+            return false;
+        }
+    }
+
+    for (auto i = 0; i < 10; ++i) {
+        auto const from = util::getRandomNumber(0uz, graph.vertex_count() - 1);
+        auto const to = util::getRandomNumber(0uz, graph.vertex_count() - 1);
+
+        // Ties between equally short paths may be broken differently, so compare lengths.
+        if (pathLength(graph, Pathfinders::SPFA::pathfind(compressed, from, to)) != pathLength(graph, Pathfinders::SPFA::pathfind(graph, from, to))) {
+            std::cout << "Path mismatch: " << G::name() << " graph\n";
+            return false;
+        }
+    }
+
+    return true;
+}
+
+int main(void)
+{
+    static constexpr int test_count = 20;
+
+    for (auto i = 0; i < test_count; ++i) {
+        // 300 vertices make some deltas need more than one varint byte.
+        if (!testCompression<Full>(30) || !testCompression<Partial>(300) || !testCompression<Tree>(300)) {
+            return 1;
+        }
+    }
+
+    std::cout << "All tests passed.\n";
+
+    return 0;
+}
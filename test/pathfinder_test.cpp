@@ -1,4 +1,6 @@
 #include "../src/pathfinder/pathfinders.hpp"
+#include "test_util.hpp"
+#include <algorithm>
 #include <iostream>
 #include <variant>
 #include <vector>
@@ -26,12 +28,14 @@ Vertex randomVertex(Graph const& graph)
 
 int main(void)
 {
-    using PathfinderTs = std::variant<Pathfinders::Dijkstra, Pathfinders::FloydWarshall, Pathfinders::BellmanFord, Pathfinders::SPFA>;
+    using PathfinderTs = std::variant<Pathfinders::Dijkstra, Pathfinders::FloydWarshall, Pathfinders::BellmanFord, Pathfinders::SPFA, Pathfinders::ParallelSPFA, Pathfinders::TreeLCA>;
     std::vector<PathfinderTs> pathfinders = {
         Pathfinders::Dijkstra {},
         Pathfinders::FloydWarshall {},
         Pathfinders::BellmanFord {},
-        Pathfinders::SPFA {}
+        Pathfinders::SPFA {},
+        Pathfinders::ParallelSPFA {},
+        Pathfinders::TreeLCA {}
     };
 
     static constexpr int test_count = 100;
@@ -59,6 +63,57 @@ int main(void)
                 }
             }
         }
+
+        auto const index = Pathfinders::TreeLCA::prepare(graph);
+        if (Pathfinders::TreeLCA::pathfind(index, from, to) != controlPath
+            || Pathfinders::TreeLCA::distance(index, from, to) != pathLength(graph, controlPath)) {
+            std::cout << "Discrepancy found!\n";
+            printGraph(graph);
+            std::cout << "Algorithms: " << firstName << " | " << Pathfinders::TreeLCA::name() << " (prepared index)\n";
+            return 1;
+        }
+    }
+
+    // Paths in a tree are unique, so racing relaxations only matter on graphs with cycles.
+    for (auto i = 0; i < test_count; ++i) {
+        auto const graph = i % 2 == 0 ? Partial::generate(100) : Full::generate(50);
+        auto const from = randomVertex(graph);
+        auto const to = randomVertex(graph);
+        auto const expected = pathLength(graph, Pathfinders::SPFA::pathfind(graph, from, to));
+
+        for (auto const thread_count : { 2uz, 4uz, 8uz }) {
+            auto const path = Pathfinders::ParallelSPFA::pathfind(graph, from, to, thread_count);
+            if (path.front() != from || path.back() != to || pathLength(graph, path) != expected) {
+                std::cout << "Discrepancy found!\n";
+                printGraph(graph);
+                std::cout << "Algorithms: " << Pathfinders::SPFA::name() << " | " << Pathfinders::ParallelSPFA::name()
+                          << " (" << thread_count << " threads)\n";
+                return 1;
+            }
+        }
+    }
+
+    using SimdLevel = Pathfinders::MultiSourceBellmanFord::SimdLevel;
+    for (auto i = 0; i < test_count; ++i) {
+        auto const graph = i % 2 == 0 ? Tree::generate(100) : Partial::generate(50);
+        auto const to = randomVertex(graph);
+
+        std::vector<Vertex> sources(util::getRandomNumber(1, 40));
+        std::ranges::generate(sources, [&graph] { return randomVertex(graph); });
+
+        std::vector<Pathfinders::Path> controlPaths;
+        for (auto const from : sources) {
+            controlPaths.push_back(Pathfinders::BellmanFord::pathfind(graph, from, to));
+        }
+
+        for (auto const level : { SimdLevel::Scalar, SimdLevel::Avx2, SimdLevel::Avx512 }) {
+            if (Pathfinders::MultiSourceBellmanFord::pathfind(graph, sources, to, level) != controlPaths) {
+                std::cout << "Discrepancy found!\n";
+                printGraph(graph);
+                std::cout << "Algorithms: " << Pathfinders::BellmanFord::name() << " | " << Pathfinders::MultiSourceBellmanFord::name() << '\n';
+                return 1;
+            }
+        }
     }
 
     std::cout << "All tests passed.\n";
@@ -0,0 +1,90 @@
+#include "../src/pathfinder/pathfinders.hpp"
+#include "../src/pathfinder/queries.hpp"
+#include "test_util.hpp"
+#include <algorithm>
+#include <iostream>
+#include <vector>
+
+using namespace Graphs;
+
+bool testQueries(Graph const& graph)
+{
+    Vertex const source = util::getRandomNumber(0uz, graph.vertex_count() - 1);
+    auto const dist = Queries::AllDistances::query(graph, source);
+
+    for (auto v = 0uz; v < graph.vertex_count(); ++v) {
+        if (dist[v] != pathLength(graph, Pathfinders::SPFA::pathfind(graph, source, v))) {
+            std::cout << "Wrong distance: " << Queries::AllDistances::name() << '\n';
+            return false;
+        }
+    }
+
+    auto const radius = util::getRandomNumber(0, 3 * kMaxRandomWeight);
+    auto const reached = Queries::Radius::query(graph, source, radius);
+    auto expected_size = 0uz;
+    for (auto const d : dist) {
+        expected_size += d <= radius;
+    }
+
+    if (reached.vertices.size() != expected_size || reached.dists.size() != expected_size) {
+        std::cout << "Wrong result size: " << Queries::Radius::name() << '\n';
+        return false;
+    }
+
+    for (auto i = 0uz; i < reached.vertices.size(); ++i) {
+        if (reached.dists[i] != dist[reached.vertices[i]] || (i > 0 && reached.dists[i - 1] > reached.dists[i])) {
+            std::cout << "Wrong distance: " << Queries::Radius::name() << '\n';
+            return false;
+        }
+    }
+
+    // Duplicates and the source itself must be handled as well.
+    std::vector<Vertex> targets(util::getRandomNumber(0, 10));
+    for (auto& target : targets) {
+        target = util::getRandomNumber(0uz, graph.vertex_count() - 1);
+    }
+    targets.push_back(source);
+    if (targets.size() > 1) {
+        targets.push_back(targets.front());
+    }
+
+    auto const result = Queries::OneToMany::query(graph, source, targets);
+    for (auto i = 0uz; i < targets.size(); ++i) {
+        if (result.dists[i] != dist[targets[i]]) {
+            std::cout << "Wrong distance: " << Queries::OneToMany::name() << '\n';
+            return false;
+        }
+    }
+
+    // The search can stop only after settling everything closer than the farthest target,
+    // and never settles a vertex twice.
+    DistType farthest = 0;
+    for (auto const target : targets) {
+        farthest = std::max(farthest, dist[target]);
+    }
+    auto closer_count = 0uz;
+    for (auto const d : dist) {
+        closer_count += d < farthest;
+    }
+    if (result.settled < closer_count || result.settled > graph.vertex_count()) {
+        std::cout << "Wrong settled count: " << Queries::OneToMany::name() << '\n';
+        return false;
+    }
+
+    return true;
+}
+
+int main(void)
+{
+    static constexpr int test_count = 50;
+
+    for (auto i = 0; i < test_count; ++i) {
+        if (!testQueries(Full::generate(30)) || !testQueries(Partial::generate(100)) || !testQueries(Tree::generate(100))) {
+            return 1;
+        }
+    }
+
+    std::cout << "All tests passed.\n";
+
+    return 0;
+}
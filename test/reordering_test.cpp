@@ -0,0 +1,63 @@
+#include "../src/pathfinder/reordering.hpp"
+#include "test_util.hpp"
+#include <iostream>
+#include <variant>
+#include <vector>
+
+using namespace Graphs;
+
+template <class G>
+bool testOrderings(size_t vertex_count)
+{
+    using OrderingTs = std::variant<Reordering::CuthillMcKee, Reordering::DegreeSort, Reordering::Gorder>;
+    std::vector<OrderingTs> orderings = {
+        Reordering::CuthillMcKee {},
+        Reordering::DegreeSort {},
+        Reordering::Gorder {}
+    };
+
+    auto const graph = G::generate(vertex_count);
+
+    for (auto const& ordering : orderings) {
+        auto const [reordered, name] = std::visit([&graph](auto&& o) { return std::make_pair(Reordering::ReorderedGraph { graph, o.order(graph) }, o.name()); }, ordering);
+        auto const& permutation = reordered.permutation();
+
+        for (auto const& [u, edges] : graph) {
+            for (auto const& [v, weight] : edges) {
+                if (reordered.graph().adjacent(permutation.toReordered(u)).at(permutation.toReordered(v)) != weight) {
+                    std::cout << "Edge mismatch: " << G::name() << " graph, " << name << " ordering\n";
+                    return false;
+                }
+            }
+        }
+
+        for (auto i = 0; i < 10; ++i) {
+            auto const from = util::getRandomNumber(0uz, graph.vertex_count() - 1);
+            auto const to = util::getRandomNumber(0uz, graph.vertex_count() - 1);
+            auto const expected = Pathfinders::SPFA::pathfind(graph, from, to);
+            auto const path = reordered.template pathfind<Pathfinders::SPFA>(from, to);
+
+            if (path.front() != static_cast<Vertex>(from) || path.back() != static_cast<Vertex>(to) || pathLength(graph, path) != pathLength(graph, expected)) {
+                std::cout << "Path mismatch: " << G::name() << " graph, " << name << " ordering\n";
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
+
+int main(void)
+{
+    static constexpr int test_count = 20;
+
+    for (auto i = 0; i < test_count; ++i) {
+        if (!testOrderings<Full>(30) || !testOrderings<Partial>(100) || !testOrderings<Tree>(100)) {
+            return 1;
+        }
+    }
+
+    std::cout << "All tests passed.\n";
+
+    return 0;
+}
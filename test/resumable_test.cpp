@@ -0,0 +1,87 @@
+#include "../src/pathfinder/resumable.hpp"
+#include "test_util.hpp"
+#include <iostream>
+#include <stdexcept>
+#include <vector>
+
+using namespace Graphs;
+
+Vertex randomVertex(Graph const& graph)
+{
+    return util::getRandomNumber(0uz, graph.vertex_count() - 1);
+}
+
+template <class P>
+bool testCompletion(Graph const& graph)
+{
+    Resumable::Scheduler scheduler;
+    std::vector<std::pair<Resumable::Scheduler::QueryId, DistType>> expected;
+
+    for (auto i = 0; i < 10; ++i) {
+        auto const from = randomVertex(graph);
+        auto const to = randomVertex(graph);
+        auto const id = scheduler.submit(P::pathfind(graph, from, to, { .slice_steps = static_cast<size_t>(i + 1) }));
+        expected.emplace_back(id, pathLength(graph, Pathfinders::SPFA::pathfind(graph, from, to)));
+    }
+
+    scheduler.run();
+
+    for (auto const& [id, dist] : expected) {
+        auto const& progress = scheduler.progress(id);
+        if (progress.status != Resumable::Status::Finished || progress.best_dist != dist || pathLength(graph, progress.path) != dist) {
+            std::cout << "Wrong result: " << P::name() << '\n';
+            return false;
+        }
+    }
+
+    return true;
+}
+
+template <class P>
+bool testStopping(Graph const& graph)
+{
+    Resumable::CancellationToken token;
+    auto query = P::pathfind(graph, 0, graph.vertex_count() - 1, { .slice_steps = 1, .token = token });
+    query.resume();
+    token.cancel();
+
+    if (query.resume() || query.progress().status != Resumable::Status::Cancelled || query.progress().frontier.empty()) {
+        std::cout << "Cancellation failed: " << P::name() << '\n';
+        return false;
+    }
+
+    auto expired = P::pathfind(graph, 0, graph.vertex_count() - 1, { .deadline = Resumable::Clock::now() });
+    if (expired.resume() || expired.progress().status != Resumable::Status::DeadlineExceeded) {
+        std::cout << "Deadline failed: " << P::name() << '\n';
+        return false;
+    }
+
+    // An empty slice would never make progress, so the query must refuse to run.
+    auto empty = P::pathfind(graph, 0, graph.vertex_count() - 1, { .slice_steps = 0 });
+    try {
+        empty.resume();
+        std::cout << "Empty slice accepted: " << P::name() << '\n';
+        return false;
+    } catch (std::invalid_argument const&) {
+    }
+
+    return true;
+}
+
+int main(void)
+{
+    static constexpr int test_count = 20;
+
+    for (auto i = 0; i < test_count; ++i) {
+        auto const graph = i % 2 == 0 ? Tree::generate(100) : Partial::generate(100);
+
+        if (!testCompletion<Resumable::Dijkstra>(graph) || !testCompletion<Resumable::SPFA>(graph)
+            || !testStopping<Resumable::Dijkstra>(graph) || !testStopping<Resumable::SPFA>(graph)) {
+            return 1;
+        }
+    }
+
+    std::cout << "All tests passed.\n";
+
+    return 0;
+}
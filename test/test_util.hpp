@@ -0,0 +1,13 @@
+#pragma once
+
+#include "../src/pathfinder/pathfinders.hpp"
+
+// Total weight of the edges along `path`; throws if some edge is missing from the graph.
+inline Graphs::DistType pathLength(Graphs::Graph const& graph, Pathfinders::Path const& path)
+{
+    Graphs::DistType length = 0;
+    for (auto i = 1uz; i < path.size(); ++i) {
+        length += graph.adjacent(path[i - 1]).at(path[i]);
+    }
+    return length;
+}